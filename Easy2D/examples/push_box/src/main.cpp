@@ -63,6 +63,9 @@ int main(int argc, char** argv) {
   resources.addSearchPath("assets");
   resources.addSearchPath("src");
 
+  // 地图块、角色和按钮图标都是小图片，打包进图集后可以合批绘制
+  resources.setTextureAtlasEnabled(true);
+
   pushbox::initStorage(exeDir);
   pushbox::g_CurrentLevel = pushbox::loadCurrentLevel(1);
   if (pushbox::g_CurrentLevel > MAX_LEVEL) {
@@ -64,6 +64,10 @@ PlayScene::PlayScene(int level) {
   font28_ = loadFont(28);
   font20_ = loadFont(20);
 
+  // 关卡信息每次变化都会出现新数字，提前在后台光栅化，避免首次显示时卡顿
+  resources.prewarmFont(font28_, "第关0123456789");
+  resources.prewarmFont(font20_, "当前最佳步0123456789按ESC返回回车重开");
+
   levelText_ = easy2d::Text::create("", font28_);
   levelText_->setPosition(520.0f, 30.0f);
   levelText_->setTextColor(easy2d::Colors::White);
@@ -106,7 +110,8 @@ PlayScene::PlayScene(int level) {
     addChild(soundBtn_);
   }
 
-  mapLayer_ = easy2d::makePtr<easy2d::Node>();
+  // 地图只在移动后整体重建，使用静态精灵层避免每帧逐个提交瓦片
+  mapLayer_ = easy2d::StaticSpriteLayer::create();
   mapLayer_->setAnchor(0.0f, 0.0f);
   mapLayer_->setPosition(0.0f, 0.0f);
   addChild(mapLayer_);
@@ -16,6 +16,30 @@ StartScene::StartScene() {
   setViewportSize(static_cast<float>(config.width), static_cast<float>(config.height));
 }
 
+// 在菜单界面后台预加载游戏场景用到的图片，进入关卡时直接命中缓存
+void StartScene::preloadGameTextures() {
+  const char* paths[] = {
+      "assets/images/wall.gif",
+      "assets/images/point.gif",
+      "assets/images/floor.gif",
+      "assets/images/box.gif",
+      "assets/images/boxinpoint.gif",
+      "assets/images/player/manup.gif",
+      "assets/images/player/mandown.gif",
+      "assets/images/player/manleft.gif",
+      "assets/images/player/manright.gif",
+      "assets/images/player/manhandup.gif",
+      "assets/images/player/manhanddown.gif",
+      "assets/images/player/manhandleft.gif",
+      "assets/images/player/manhandright.gif",
+  };
+
+  auto& resources = easy2d::Application::instance().resources();
+  for (auto* path : paths) {
+    preloads_.push_back(resources.loadTextureAsync(path));
+  }
+}
+
 static easy2d::Ptr<easy2d::FontAtlas> loadMenuFont() {
   auto& resources = easy2d::Application::instance().resources();
   const char* candidates[] = {
@@ -42,6 +66,8 @@ void StartScene::onEnter() {
   setBackgroundColor(easy2d::Colors::Black);
 
   if (getChildren().empty()) {
+    preloadGameTextures();
+
     auto audioNode = AudioController::create();
     audioNode->setName("audio_controller");
     addChild(audioNode);
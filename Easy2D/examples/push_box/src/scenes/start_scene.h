@@ -15,10 +15,12 @@ private:
   void startNewGame();
   void continueGame();
   void exitGame();
+  void preloadGameTextures();
 
   easy2d::Ptr<MenuButton> resumeBtn_;
   easy2d::Ptr<easy2d::ToggleImageButton> soundBtn_;
   easy2d::Ptr<easy2d::FontAtlas> font_;
+  std::vector<easy2d::Ptr<easy2d::TextureHandle>> preloads_;  // 持有预加载的纹理
 };
 
 } // namespace pushbox
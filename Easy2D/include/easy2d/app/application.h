@@ -17,6 +17,7 @@ class TimerManager;
 class EventQueue;
 class EventDispatcher;
 class Camera;
+class ThreadPool;
 
 // ============================================================================
 // Application 配置
@@ -31,6 +32,9 @@ struct AppConfig {
     int fpsLimit = 0;  // 0 = 不限制
     BackendType renderBackend = BackendType::OpenGL;
     int msaaSamples = 0;
+    SpriteRenderPath spriteRenderPath = SpriteRenderPath::Vertices;  // 精灵提交路径
+    int workerThreads = -1;  // 工作线程数，-1 = 自动（硬件线程数 - 1），0 = 不创建
+    size_t textureUploadBudget = 4 * 1024 * 1024;  // 每帧异步纹理上传的字节预算（至少上传一张）
 };
 
 // ============================================================================
@@ -74,6 +78,7 @@ public:
     EventQueue& eventQueue();
     EventDispatcher& eventDispatcher();
     Camera& camera();
+    ThreadPool& threadPool();
 
     // ------------------------------------------------------------------------
     // 便捷方法
@@ -108,6 +113,7 @@ private:
     UniquePtr<EventQueue> eventQueue_;
     UniquePtr<EventDispatcher> eventDispatcher_;
     UniquePtr<Camera> camera_;
+    UniquePtr<ThreadPool> threadPool_;
 
     // 状态
     bool initialized_ = false;
@@ -15,9 +15,15 @@
 
 // Graphics
 #include <easy2d/graphics/render_backend.h>
+#include <easy2d/graphics/render_target.h>
 #include <easy2d/graphics/texture.h>
+#include <easy2d/graphics/texture_region.h>
 #include <easy2d/graphics/font.h>
+#include <easy2d/graphics/glyph_run.h>
 #include <easy2d/graphics/camera.h>
+#include <easy2d/graphics/render_command.h>
+#include <easy2d/graphics/render_queue.h>
+#include <easy2d/graphics/static_sprite_buffer.h>
 
 // Scene
 #include <easy2d/scene/node.h>
@@ -25,6 +31,8 @@
 #include <easy2d/scene/sprite.h>
 #include <easy2d/scene/text.h>
 #include <easy2d/scene/shape_node.h>
+#include <easy2d/scene/static_sprite_layer.h>
+#include <easy2d/scene/tile_map.h>
 #include <easy2d/scene/scene_manager.h>
 #include <easy2d/scene/transition.h>
 
@@ -49,12 +57,15 @@
 
 // Resource
 #include <easy2d/resource/resource_manager.h>
+#include <easy2d/resource/texture_handle.h>
+#include <easy2d/resource/asset_bundle.h>
 
 // Utils
 #include <easy2d/utils/logger.h>
 #include <easy2d/utils/timer.h>
 #include <easy2d/utils/data.h>
 #include <easy2d/utils/random.h>
+#include <easy2d/utils/thread_pool.h>
 
 // Spatial
 #include <easy2d/spatial/spatial_index.h>
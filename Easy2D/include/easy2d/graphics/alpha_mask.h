@@ -8,31 +8,50 @@ namespace easy2d {
 
 // ============================================================================
 // Alpha 遮罩 - 存储图片的非透明区域信息
+// 每个像素只占 1 位：创建时按阈值判定是否不透明；另外为每个 8x8 像素块记录
+// 覆盖情况（全透明 / 全不透明 / 混合），大部分查询只需读取块信息
 // ============================================================================
 class AlphaMask {
 public:
+    // 8x8 像素块的覆盖情况
+    enum class Coverage : uint8_t {
+        Empty,      // 全部透明
+        Full,       // 全部不透明
+        Mixed       // 需要逐像素判断
+    };
+
+    static constexpr int TILE_SIZE = 8;
+
     AlphaMask() = default;
     AlphaMask(int width, int height);
     
-    /// 从像素数据创建遮罩
-    static AlphaMask createFromPixels(const uint8_t* pixels, int width, int height, int channels);
+    /// 从像素数据创建遮罩，Alpha 不小于 threshold 的像素视为不透明
+    static AlphaMask createFromPixels(const uint8_t* pixels, int width, int height, int channels,
+                                      uint8_t threshold = 128);
     
-    /// 获取指定位置的透明度（0-255）
+    /// 获取指定位置的透明度（不透明为 255，透明或越界为 0）
     uint8_t getAlpha(int x, int y) const;
     
     /// 检查指定位置是否不透明
-    bool isOpaque(int x, int y, uint8_t threshold = 128) const;
+    bool isOpaque(int x, int y) const;
     
     /// 检查指定位置是否在遮罩范围内
     bool isValid(int x, int y) const;
+
+    /// 获取像素所在块的覆盖情况（越界视为全透明）
+    Coverage getTileCoverage(int x, int y) const;
     
     /// 获取遮罩尺寸
     int getWidth() const { return width_; }
     int getHeight() const { return height_; }
     Size getSize() const { return Size(static_cast<float>(width_), static_cast<float>(height_)); }
     
-    /// 获取原始数据
+    /// 获取原始数据（按行排列的位图，每行补齐到整字节，每字节 8 个像素，低位在前）
     const std::vector<uint8_t>& getData() const { return data_; }
+    int getStride() const { return stride_; }
+
+    /// 占用的内存字节数
+    size_t getMemoryUsage() const { return data_.size() + tiles_.size(); }
     
     /// 检查遮罩是否有效
     bool isValid() const { return !data_.empty() && width_ > 0 && height_ > 0; }
@@ -40,7 +59,14 @@ public:
 private:
     int width_ = 0;
     int height_ = 0;
-    std::vector<uint8_t> data_;  // Alpha值数组
+    int stride_ = 0;                // 每行字节数
+    int tilesX_ = 0;
+    int tilesY_ = 0;
+    std::vector<uint8_t> data_;     // 不透明位图
+    std::vector<Coverage> tiles_;   // 块覆盖信息
+
+    void buildRow(const uint8_t* pixels, int channels, uint8_t threshold, uint8_t* bits) const;
+    void buildTiles();
 };
 
 } // namespace easy2d
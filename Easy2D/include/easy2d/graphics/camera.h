@@ -37,6 +37,9 @@ public:
     void setViewport(const Rect& rect);
     Rect getViewport() const;
 
+    // 当前可见区域的世界坐标 AABB（由视图投影矩阵反推，包含缩放和旋转）
+    Rect getWorldBounds() const;
+
     // ------------------------------------------------------------------------
     // 矩阵获取
     // ------------------------------------------------------------------------
@@ -4,9 +4,12 @@
 #include <easy2d/core/color.h>
 #include <easy2d/core/string.h>
 #include <easy2d/core/math_types.h>
+#include <string>
 
 namespace easy2d {
 
+class ThreadPool;
+
 // ============================================================================
 // 字形信息
 // ============================================================================
@@ -18,6 +21,17 @@ struct Glyph {
     float bearingX;     // 水平偏移
     float bearingY;     // 垂直偏移
     float advance;      // 前进距离
+    uint32_t page = 0;  // 所在图集页
+};
+
+// ============================================================================
+// 动态字形图集配置
+// ============================================================================
+struct FontAtlasConfig {
+    int pageSize = 512;                 // 每页边长（像素）
+    int maxPages = 4;                   // 页数上限，用满后淘汰长时间未使用的字形
+    uint32_t evictAfterFrames = 300;    // 字形连续多少帧未使用后可被淘汰；放不下的字形也在这之后重试
+    std::string diskCacheDir;           // 字形磁盘缓存目录，为空时不缓存
 };
 
 // ============================================================================
@@ -30,8 +44,15 @@ public:
     // 获取字形信息
     virtual const Glyph* getGlyph(char32_t codepoint) const = 0;
     
-    // 获取纹理
+    // 获取纹理（多页图集为第 0 页）
     virtual class Texture* getTexture() const = 0;
+
+    // 图集页数量及指定页的纹理（Glyph::page）
+    virtual size_t getPageCount() const { return 1; }
+    virtual class Texture* getPageTexture(uint32_t page) const { return page == 0 ? getTexture() : nullptr; }
+
+    // 字形代数：已缓存的字形被淘汰或移动位置时递增，缓存排版结果（GlyphRun）据此失效
+    virtual uint32_t getGeneration() const { return 0; }
     
     // 获取字体大小
     virtual int getFontSize() const = 0;
@@ -46,6 +67,11 @@ public:
     
     // 是否支持 SDF 渲染
     virtual bool isSDF() const = 0;
+
+    // 预光栅化文字中的字符（如字符串表、常用字集），pool 为空时在调用线程完成
+    // 之后首次用到这些字形时只需放入图集，不再光栅化
+    virtual void prewarm(const String& text, ThreadPool* pool = nullptr) { (void)text; (void)pool; }
+    virtual bool isPrewarming() const { return false; }
 };
 
 } // namespace easy2d
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace easy2d {
+
+// ============================================================================
+// 字形磁盘缓存 - 保存光栅化结果（像素 + 偏移），下次运行直接读取，跳过
+// stb_truetype 光栅化（SDF 生成尤其昂贵）
+// 每个文件对应一种字体内容（哈希）、字号和模式；打开时整体读入内存，
+// 新光栅化的字形追加到文件末尾。只缓存字形本身，不缓存在图集中的位置，
+// 因此与图集的淘汰和压缩互不影响。
+//
+// 文件布局（小端序）：
+//   Header
+//   { Record, 像素[width * height] }...   末尾不完整的记录在打开时截掉
+// ============================================================================
+class GlyphDiskCache {
+public:
+    struct Entry {
+        int width = 0;
+        int height = 0;
+        int xoff = 0;
+        int yoff = 0;
+        const uint8_t* pixels = nullptr;    // 下一次 append 之前有效
+    };
+
+    GlyphDiskCache() = default;
+    ~GlyphDiskCache();
+
+    // 禁止拷贝
+    GlyphDiskCache(const GlyphDiskCache&) = delete;
+    GlyphDiskCache& operator=(const GlyphDiskCache&) = delete;
+
+    /// 打开（不存在时创建）目录下对应的缓存文件，失败时缓存不可用
+    bool open(const std::string& directory, const uint8_t* fontData, size_t fontDataSize,
+              int fontSize, bool sdf);
+
+    bool isOpen() const { return file_.is_open(); }
+
+    /// 查找字形，width 为 0 表示没有可见像素
+    bool find(char32_t codepoint, Entry& entry) const;
+
+    /// 记录新光栅化的字形（写入内存并追加到文件）
+    void append(char32_t codepoint, int width, int height, int xoff, int yoff, const uint8_t* pixels);
+
+    size_t size() const { return index_.size(); }
+    const std::string& getPath() const { return path_; }
+
+private:
+    // 解析文件内容，返回完整记录的总长度
+    size_t parse();
+
+    std::string path_;
+    std::ofstream file_;
+    std::vector<uint8_t> data_;                     // 文件内容（含头部）
+    std::unordered_map<char32_t, size_t> index_;    // 字符 -> 记录在 data_ 中的偏移
+};
+
+} // namespace easy2d
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <easy2d/core/string.h>
+#include <easy2d/core/math_types.h>
+#include <vector>
+
+namespace easy2d {
+
+class FontAtlas;
+class Texture;
+
+// ============================================================================
+// 字形串 - 一段文字的排版结果缓存
+// 保存每个可见字形相对于文字左上角的矩形、纹理坐标和所在图集页纹理，
+// 绘制时直接写入精灵批次，不必每帧解码 UTF-8 和逐字查询字形。
+// 文字或字体变化后由持有者调用 invalidate()；图集淘汰或移动字形时
+// 代数（FontAtlas::getGeneration）改变，isValid() 随之返回 false。
+// ============================================================================
+class GlyphRun {
+public:
+    struct Quad {
+        Rect rect;              // 相对于文字左上角
+        float u0, v0;
+        float u1, v1;
+        Texture* texture;       // 构建时的图集页纹理
+    };
+
+    /// 按字体排版文字，替换之前的内容
+    void build(const FontAtlas& font, const String& text);
+
+    /// 是否仍可用于该字体绘制
+    bool isValid(const FontAtlas& font) const;
+    void invalidate() { font_ = nullptr; }
+
+    const std::vector<Quad>& getQuads() const { return quads_; }
+    bool empty() const { return quads_.empty(); }
+
+    // 与 FontAtlas::measureText 相同的尺寸
+    Vec2 getSize() const { return size_; }
+    bool isSDF() const { return sdf_; }
+
+private:
+    std::vector<Quad> quads_;
+    Vec2 size_ = Vec2::Zero();
+    const FontAtlas* font_ = nullptr;
+    uint32_t generation_ = 0;
+    bool sdf_ = false;
+};
+
+} // namespace easy2d
@@ -5,10 +5,15 @@
 #include <easy2d/core/math_types.h>
 #include <easy2d/graphics/font.h>
 #include <easy2d/graphics/texture.h>
+#include <easy2d/graphics/glyph_disk_cache.h>
 #include <easy2d/graphics/opengl/gl_texture.h>
 #include <stb/stb_truetype.h>
 #include <stb/stb_rect_pack.h>
+#include <array>
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -16,15 +21,25 @@ namespace easy2d {
 
 // ============================================================================
 // OpenGL 字体图集实现 - 使用 stb_rect_pack 进行矩形打包
+// 字形按需光栅化到多个图集页；页数达到上限后，淘汰长时间未使用的字形最多的一页
+// 并重新紧凑打包该页。放不下的字形会被负缓存（只前进不绘制），一段时间后再重试。
+// prewarm 在线程池中光栅化字形，主线程用到时只负责打包和上传。
+// 配置了 diskCacheDir 时，光栅化结果写入磁盘缓存，下次运行直接读取。
+// 图集页为单通道 R8：SDF 存距离，普通字形存覆盖率并通过纹理通道重排采样为白色 + Alpha。
+// 新字形先写入页的内存副本并扩大脏矩形，在下一次绘制调用前统一上传（flushUploads）。
 // ============================================================================
 class GLFontAtlas : public FontAtlas {
 public:
     GLFontAtlas(const std::string& filepath, int fontSize, bool useSDF = false);
+    GLFontAtlas(const std::string& filepath, int fontSize, bool useSDF, const FontAtlasConfig& config);
     ~GLFontAtlas();
 
     // FontAtlas 接口实现
     const Glyph* getGlyph(char32_t codepoint) const override;
-    Texture* getTexture() const override { return texture_.get(); }
+    Texture* getTexture() const override { return getPageTexture(0); }
+    size_t getPageCount() const override { return pages_.size(); }
+    Texture* getPageTexture(uint32_t page) const override;
+    uint32_t getGeneration() const override { return generation_.load(std::memory_order_acquire); }
     int getFontSize() const override { return fontSize_; }
     float getAscent() const override { return ascent_; }
     float getDescent() const override { return descent_; }
@@ -32,32 +47,142 @@ public:
     float getLineHeight() const override { return ascent_ - descent_ + lineGap_; }
     Vec2 measureText(const String& text) override;
     bool isSDF() const override { return useSDF_; }
+    void prewarm(const String& text, ThreadPool* pool = nullptr) override;
+    bool isPrewarming() const override;
+
+    // 统计
+    size_t getCachedGlyphCount() const { return glyphs_.size(); }
+    size_t getEvictedGlyphCount() const { return evictedGlyphs_; }
+    size_t getPrewarmedGlyphCount() const;    // 已光栅化、等待放入图集的字形
+
+    // 默认配置，作用于之后创建的图集
+    static void setDefaultConfig(const FontAtlasConfig& config);
+    static const FontAtlasConfig& getDefaultConfig();
+
+    // 推进字形使用记录的帧计数，由渲染器在每帧结束时调用；
+    // 同时把已完成的预光栅化结果转存到磁盘缓存
+    static void advanceFrame();
+
+    // 上传所有图集页的脏区域，由精灵批次在发出绘制调用前调用
+    static void flushUploads();
 
 private:
-    // 图集配置
-    static constexpr int ATLAS_WIDTH = 512;
-    static constexpr int ATLAS_HEIGHT = 512;
     static constexpr int PADDING = 2;  // 字形之间的间距
 
+    struct Page {
+        std::unique_ptr<GLTexture> texture;
+        stbrp_context packContext;
+        std::vector<stbrp_node> packNodes;
+
+        // 内存副本（纹理行序）及尚未上传的区域 [dirtyMinX, dirtyMaxX) x [dirtyMinY, dirtyMaxY)
+        std::vector<uint8_t> pixels;
+        int dirtyMinX = 0;
+        int dirtyMinY = 0;
+        int dirtyMaxX = 0;
+        int dirtyMaxY = 0;
+
+        bool isDirty() const { return dirtyMaxX > dirtyMinX; }
+        void clearDirty() { dirtyMinX = dirtyMinY = dirtyMaxX = dirtyMaxY = 0; }
+    };
+
+    struct GlyphSlot {
+        Glyph glyph;
+        uint64_t lastUsed = 0;  // 最近使用的帧；未放置时为放置失败的帧
+        bool cached = false;    // 槽是否有效
+        bool placed = false;
+    };
+
+    // 字形表 - 每个字符每帧都要查询，避免哈希：
+    // ASCII 直接索引；其余 BMP 字符按高字节分块，只为用到的块分配 256 项的稠密数组；
+    // BMP 之外的字符（表情等）较少，退回哈希表。槽的地址在擦除其他字形时保持不变。
+    class GlyphTable {
+    public:
+        static constexpr size_t BLOCK_SIZE = 256;
+
+        GlyphSlot* find(char32_t codepoint);
+        // 返回清空后的槽，并标记为有效
+        GlyphSlot& insert(char32_t codepoint);
+        void erase(char32_t codepoint);
+        size_t size() const { return count_; }
+
+        // fn(char32_t codepoint, GlyphSlot& slot)，遍历期间可以擦除当前字形
+        template <typename Fn>
+        void forEach(Fn&& fn);
+
+    private:
+        using Block = std::array<GlyphSlot, BLOCK_SIZE>;
+
+        GlyphSlot ascii_[128];
+        std::array<std::unique_ptr<Block>, 0x10000 / BLOCK_SIZE> blocks_;
+        std::unordered_map<char32_t, GlyphSlot> overflow_;
+        size_t count_ = 0;
+    };
+
+    // 单通道光栅化结果（SDF 距离或覆盖率）
+    struct Bitmap {
+        std::vector<uint8_t> pixels;
+        int width = 0;
+        int height = 0;
+        int xoff = 0;
+        int yoff = 0;
+    };
+
+    // 预光栅化结果队列，与工作线程共享；图集销毁时取消尚未开始的字形
+    // 主线程改为同步光栅化的字符从 requested 中移除，之后完成的结果直接丢弃，
+    // 因此 ready 中只有仍被等待的字符
+    struct PrewarmQueue {
+        std::mutex mutex;
+        std::unordered_set<char32_t> requested;         // 已提交且尚未取用的字符
+        std::unordered_map<char32_t, Bitmap> ready;     // 没有可见像素的字形宽度为 0
+        std::atomic<size_t> pendingTasks{ 0 };
+        std::atomic<bool> cancelled{ false };
+    };
+
     int fontSize_;
     bool useSDF_;
-    mutable std::unique_ptr<GLTexture> texture_;
-    mutable std::unordered_map<char32_t, Glyph> glyphs_;
-    
-    // stb_rect_pack 上下文
-    mutable stbrp_context packContext_;
-    mutable std::vector<stbrp_node> packNodes_;
-    mutable int currentY_;
+    FontAtlasConfig config_;
+    mutable std::vector<std::unique_ptr<Page>> pages_;
+    mutable GlyphTable glyphs_;
+    mutable size_t evictedGlyphs_;
+    mutable bool warnedFull_;
+    // 并行收集渲染命令时工作线程会读取
+    mutable std::atomic<uint32_t> generation_;
+    mutable bool pendingUpload_;    // 已登记到待上传列表
+    bool pendingDrain_;             // 已登记到预光栅化转存列表
+
+    // 压缩时换下的旧页纹理：本帧已提交的绘制可能仍引用它，下一帧再释放
+    mutable std::vector<std::unique_ptr<GLTexture>> retiredTextures_;
+    mutable uint64_t retiredFrame_;
     
-    std::vector<unsigned char> fontData_;
+    Ptr<std::vector<unsigned char>> fontData_;    // 预光栅化任务共享，图集销毁后仍有效
     stbtt_fontinfo fontInfo_;
+    Ptr<PrewarmQueue> prewarmQueue_;
+    mutable std::unique_ptr<GlyphDiskCache> diskCache_;
     float scale_;
     float ascent_;
     float descent_;
     float lineGap_;
 
-    void createAtlas();
-    void cacheGlyph(char32_t codepoint) const;
+    GlyphSlot& cacheGlyph(char32_t codepoint) const;
+    bool rasterize(char32_t codepoint, Bitmap& bitmap) const;
+    bool takePrewarmed(char32_t codepoint, Bitmap& bitmap, bool& visible) const;
+    // 把已完成的预光栅化结果写入磁盘缓存，返回是否仍有未完成的字符
+    bool drainPrewarmed();
+    // 只读取字体数据，可在工作线程中调用
+    static bool rasterizeOutline(const stbtt_fontinfo& info, float scale, bool useSDF,
+                                 char32_t codepoint, Bitmap& bitmap);
+
+    Page& createPage() const;
+    void resetPacker(Page& page) const;
+    bool pack(Page& page, int width, int height, int& x, int& y) const;
+    bool place(int width, int height, uint32_t& page, int& x, int& y) const;
+    int compactStalePage() const;
+
+    void setGlyphCoords(Glyph& glyph, int atlasX, int atlasY) const;
+    void writeGlyph(Page& page, int atlasX, int atlasY, const Bitmap& bitmap) const;
+    void uploadDirtyPages() const;
+    std::unique_ptr<GLTexture> createPageTexture(const Page& page) const;
+    void releaseRetiredTextures() const;
 };
 
 } // namespace easy2d
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <easy2d/graphics/render_target.h>
+#include <GL/glew.h>
+
+namespace easy2d {
+
+class GLTexture;
+
+// ============================================================================
+// OpenGL 渲染目标 - 帧缓冲对象 + RGBA8 颜色纹理
+// ============================================================================
+class GLRenderTarget : public RenderTarget {
+public:
+    GLRenderTarget(int width, int height);
+    ~GLRenderTarget() override;
+
+    // 禁止拷贝
+    GLRenderTarget(const GLRenderTarget&) = delete;
+    GLRenderTarget& operator=(const GLRenderTarget&) = delete;
+
+    // RenderTarget 接口实现
+    int getWidth() const override { return width_; }
+    int getHeight() const override { return height_; }
+    Ptr<Texture> getTexture() const override;
+    bool isValid() const override { return framebuffer_ != 0; }
+
+    // OpenGL 特定
+    GLuint getFramebufferID() const { return framebuffer_; }
+
+private:
+    GLuint framebuffer_;
+    int width_;
+    int height_;
+    Ptr<GLTexture> texture_;
+};
+
+} // namespace easy2d
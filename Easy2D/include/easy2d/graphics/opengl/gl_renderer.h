@@ -4,10 +4,12 @@
 #include <easy2d/graphics/opengl/gl_shader.h>
 #include <easy2d/graphics/opengl/gl_sprite_batch.h>
 #include <GL/glew.h>
+#include <vector>
 
 namespace easy2d {
 
 class Window;
+class GLTexture;
 
 // ============================================================================
 // OpenGL 渲染器实现
@@ -25,6 +27,11 @@ public:
     void endFrame() override;
     void setViewport(int x, int y, int width, int height) override;
     void setVSync(bool enabled) override;
+    void clear(const Color& color) override;
+
+    Ptr<RenderTarget> createRenderTarget(int width, int height) override;
+    void setRenderTarget(Ptr<RenderTarget> target) override;
+    Ptr<RenderTarget> getRenderTarget() const override { return renderTarget_; }
 
     void setBlendMode(BlendMode mode) override;
     void setViewProjection(const glm::mat4& matrix) override;
@@ -38,6 +45,12 @@ public:
     void drawSprite(const Texture& texture, const Vec2& position, const Color& tint) override;
     void endSpriteBatch() override;
 
+    void setSpriteRenderPath(SpriteRenderPath path) override;
+    SpriteRenderPath getSpriteRenderPath() const override;
+
+    Ptr<StaticSpriteBuffer> createStaticSpriteBuffer() override;
+    void drawStaticSprites(const StaticSpriteBuffer& buffer, const glm::mat4& transform) override;
+
     void drawLine(const Vec2& start, const Vec2& end, const Color& color, float width) override;
     void drawRect(const Rect& rect, const Color& color, float width) override;
     void fillRect(const Rect& rect, const Color& color) override;
@@ -51,24 +64,34 @@ public:
     Ptr<FontAtlas> createFontAtlas(const std::string& filepath, int fontSize, bool useSDF = false) override;
     void drawText(const FontAtlas& font, const String& text, const Vec2& position, const Color& color) override;
     void drawText(const FontAtlas& font, const String& text, float x, float y, const Color& color) override;
+    void drawGlyphRun(const GlyphRun& run, const Vec2& position, const Color& color) override;
 
-    Stats getStats() const override { return stats_; }
+    Stats getStats() const override;
     void resetStats() override;
 
 private:
     Window* window_;
     GLSpriteBatch spriteBatch_;
-    GLShader shapeShader_;
-    
-    GLuint shapeVao_;
-    GLuint shapeVbo_;
+    bool batchActive_;
+
+    // 形状渲染：1x1 白色纹理 + 扇形顶点临时缓冲
+    Ptr<GLTexture> whiteTexture_;
+    std::vector<glm::vec2> shapeScratch_;
     
     glm::mat4 viewProjection_;
+    Ptr<RenderTarget> renderTarget_;
+    int viewport_[4];   // 窗口视口，切回窗口时恢复
+    BlendMode blendMode_;
     Stats stats_;
     bool vsync_;
 
-    void initShapeRendering();
+    bool initShapeRendering();
+    void ensureSpriteBatch();
+    void pushShapeQuad(const glm::vec2& v0, const glm::vec2& v1,
+                       const glm::vec2& v2, const glm::vec2& v3, uint32_t color);
+    void pushShapeFan(const glm::vec2& pivot, const glm::vec2* rim, size_t count, uint32_t color);
     void setupBlendMode(BlendMode mode);
+    glm::mat4 getEffectiveViewProjection() const;
 };
 
 } // namespace easy2d
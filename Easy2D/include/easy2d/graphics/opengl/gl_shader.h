@@ -1,8 +1,10 @@
 #pragma once
 
 #include <GL/glew.h>
+#include <cstring>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <glm/mat4x4.hpp>
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
@@ -12,6 +14,8 @@ namespace easy2d {
 
 // ============================================================================
 // OpenGL Shader 程序
+// 链接后枚举所有活动 uniform，位置在编译期解析完毕；
+// 每个 uniform 缓存最近一次上传的值，值未变化时跳过 glUniform 调用
 // ============================================================================
 class GLShader {
 public:
@@ -24,11 +28,21 @@ public:
     // 从文件加载并编译
     bool compileFromFile(const std::string& vertexPath, const std::string& fragmentPath);
 
-    // 使用/激活
+    // 使用/激活（经由 GLStateCache，已绑定时不重复调用）
     void bind() const;
     void unbind() const;
 
-    // Uniform 设置
+    // 查询 uniform 位置（不存在时返回 -1），用于预先解析频繁设置的 uniform
+    GLint getUniformLocation(const std::string& name) const;
+
+    // Uniform 设置（按预先解析的位置，需已绑定本程序）
+    void setInt(GLint location, int value);
+    void setFloat(GLint location, float value);
+    void setVec2(GLint location, const glm::vec2& value);
+    void setVec4(GLint location, const glm::vec4& value);
+    void setMat4(GLint location, const glm::mat4& value);
+
+    // Uniform 设置（按名称）
     void setBool(const std::string& name, bool value);
     void setInt(const std::string& name, int value);
     void setFloat(const std::string& name, float value);
@@ -44,11 +58,37 @@ public:
     bool isValid() const { return programID_ != 0; }
 
 private:
+    // 每个 uniform 最近一次上传的值
+    struct UniformValue {
+        float data[16];
+        bool valid = false;
+    };
+
     GLuint programID_;
     std::unordered_map<std::string, GLint> uniformCache_;
+    std::vector<int32_t> valueSlots_;       // 位置 -> values_ 下标，-1 表示未登记
+    std::vector<UniformValue> values_;
 
     GLuint compileShader(GLenum type, const char* source);
-    GLint getUniformLocation(const std::string& name);
+    void resolveUniforms();
+    void release();
+
+    // 与缓存比较，值变化时更新缓存并返回 true
+    template <typename T>
+    bool updateValue(GLint location, const T& value) {
+        static_assert(sizeof(T) <= sizeof(UniformValue::data), "uniform value too large");
+        if (location < 0) return false;
+        if (static_cast<size_t>(location) >= valueSlots_.size() || valueSlots_[location] < 0) {
+            return true;
+        }
+        UniformValue& cached = values_[valueSlots_[location]];
+        if (cached.valid && std::memcmp(cached.data, &value, sizeof(T)) == 0) {
+            return false;
+        }
+        std::memcpy(cached.data, &value, sizeof(T));
+        cached.valid = true;
+        return true;
+    }
 };
 
 } // namespace easy2d
@@ -6,31 +6,80 @@
 #include <easy2d/graphics/texture.h>
 #include <easy2d/graphics/opengl/gl_shader.h>
 #include <glm/mat4x4.hpp>
+#include <string>
 #include <vector>
 
 namespace easy2d {
 
+class GLStaticSpriteBuffer;
+
 // ============================================================================
 // OpenGL 精灵批渲染器
+// 顶点直接写入映射的流式缓冲区：
+// - 支持 GL_ARB_buffer_storage 时使用持久映射的三段环形缓冲，每段以栅栏同步
+// - 否则退化为 glMapBufferRange 非同步追加写入 + 写满时孤立（orphan）缓冲区
+// 每个批次最多同时绑定 MAX_TEXTURE_SLOTS 张纹理，顶点携带纹理槽索引，
+// 只有纹理槽用尽、SDF 状态改变或缓冲区写满时才会打断批次
+// 顶点为 20 字节的紧凑格式：float 位置、unorm16 纹理坐标、RGBA8 颜色、纹理槽索引；
+// 纹理坐标超出 [0,1] 的精灵（重复环绕的平铺）改用 float 纹理坐标的 24 字节格式，不截断
+//
+// 两种精灵提交路径（setInstancingEnabled 切换）：
+// - 顶点路径：CPU 计算旋转后的四个角，每个精灵写入 4 个顶点
+// - 实例化路径：每个精灵写入 1 条实例记录，由顶点着色器展开四边形
+// 任意四边形（drawQuad，用于形状）总是走顶点路径，两种批次共用同一流式缓冲区
 // ============================================================================
 class GLSpriteBatch {
 public:
     static constexpr size_t MAX_SPRITES = 10000;
     static constexpr size_t VERTICES_PER_SPRITE = 4;
     static constexpr size_t INDICES_PER_SPRITE = 6;
+    static constexpr size_t RING_SEGMENTS = 3;
+    static constexpr size_t SEGMENT_VERTICES = MAX_SPRITES * VERTICES_PER_SPRITE;
+    static constexpr uint32_t MAX_TEXTURE_SLOTS = 16;
+
+    enum class BatchKind : uint8_t {
+        Quads,      // 每个元素 4 个顶点
+        WideQuads,  // 每个元素 4 个 WideVertex 顶点
+        Instances   // 每个元素 1 条实例记录
+    };
 
     struct Vertex {
+        glm::vec2 position;
+        uint16_t texCoord[2];   // unorm16，着色器中归一化为 0-1
+        uint32_t color;         // RGBA8（内存中按 R、G、B、A 字节排列），着色器中归一化
+        uint32_t texIndex;
+    };
+    static_assert(sizeof(Vertex) == 20, "sprite vertex must stay tightly packed");
+
+    // 纹理坐标超出 unorm16 范围时使用的顶点
+    struct WideVertex {
         glm::vec2 position;
         glm::vec2 texCoord;
-        glm::vec4 color;
+        uint32_t color;
+        uint32_t texIndex;
     };
+    static_assert(sizeof(WideVertex) == 24, "wide sprite vertex must stay tightly packed");
+
+    // 实例记录：四边形由顶点着色器按 position/size/anchor/rotation 展开
+    struct Instance {
+        glm::vec2 position;
+        glm::vec2 size;
+        glm::vec2 anchor;
+        uint16_t texRect[4];    // unorm16：u0, v0, u1, v1
+        uint32_t color;         // RGBA8
+        float rotation;         // 弧度
+        uint32_t texIndex;
+    };
+    static_assert(sizeof(Instance) == 44, "sprite instance must stay tightly packed");
+
+    static constexpr size_t SEGMENT_BYTES = SEGMENT_VERTICES * sizeof(Vertex);
 
     struct SpriteData {
         glm::vec2 position;
         glm::vec2 size;
         glm::vec2 texCoordMin;
         glm::vec2 texCoordMax;
-        glm::vec4 color;
+        uint32_t color = 0xFFFFFFFF;    // packColor 转换后的颜色，每个节点转换一次
         float rotation;
         glm::vec2 anchor;
         bool isSDF = false;
@@ -44,30 +93,105 @@ public:
 
     void begin(const glm::mat4& viewProjection);
     void draw(const Texture& texture, const SpriteData& data);
+    // 提交任意四边形（顶点顺序为 v0-v1-v2-v3，三角形为 012、023），所有顶点使用同一纹理坐标
+    // 用于形状渲染：配合 1x1 白色纹理，形状与精灵共用同一管线和批次
+    void drawQuad(const Texture& texture, const glm::vec2* positions,
+                  const glm::vec2& texCoord, uint32_t color);
     void end();
 
+    // 提交当前批次后绘制静态精灵缓冲区（每种纹理一次绘制调用）
+    void drawStatic(const GLStaticSpriteBuffer& buffer, const glm::mat4& transform);
+
+    // 将浮点颜色转换为顶点使用的 RGBA8 格式
+    static uint32_t packColor(const Color& color);
+
+    // 由目标矩形/源矩形（像素）构造精灵数据，rotation 为角度
+    static SpriteData makeSpriteData(const Texture& texture, const Rect& destRect, const Rect& srcRect,
+                                     const Color& tint, float rotation, const Vec2& anchor);
+    // 纹理坐标是否在 [0,1] 内（可以使用紧凑顶点和实例记录）
+    static bool fitsPackedTexCoords(const SpriteData& data);
+    // 按精灵数据计算四个顶点（与批次的顶点路径一致）
+    static void buildQuad(const SpriteData& data, uint32_t slot, Vertex* out);
+    static void buildQuad(const SpriteData& data, uint32_t slot, WideVertex* out);
+    // 为当前绑定的 VAO 设置 Vertex / WideVertex 格式的顶点属性
+    static void setupVertexAttributes();
+    static void setupWideVertexAttributes();
+
+    // 提交当前批次后切换视图投影矩阵
+    void setViewProjection(const glm::mat4& viewProjection);
+
+    // 帧结束：为当前环形缓冲段插入栅栏并切换到下一段
+    void endFrame();
+
+    // 是否使用持久映射的环形缓冲
+    bool isPersistentMapped() const { return persistent_; }
+
+    // 精灵提交路径：开启后 draw 写入实例记录，由 GPU 展开四边形
+    void setInstancingEnabled(bool enabled);
+    bool isInstancingEnabled() const { return instancing_; }
+
     // 统计
     uint32_t getDrawCallCount() const { return drawCallCount_; }
     uint32_t getSpriteCount() const { return spriteCount_; }
+    uint32_t getBatchBreakCount() const { return batchBreakCount_; }
 
 private:
+    // 每批次设置的 uniform（编译后解析位置）
+    struct ShaderUniforms {
+        GLint viewProjection = -1;
+        GLint useSDF = -1;
+    };
+
     GLuint vao_;
+    GLuint wideVao_;            // 与 vao_ 共用顶点和索引缓冲区，属性按 WideVertex 解释
     GLuint vbo_;
     GLuint ibo_;
     GLShader shader_;
-    
-    std::vector<Vertex> vertices_;
-    std::vector<GLuint> indices_;
-    
-    const Texture* currentTexture_;
+    ShaderUniforms uniforms_;
+
+    // 实例化路径：单位四边形角点 + 每次绘制重新指向流式缓冲区的实例属性
+    GLuint instanceVao_;
+    GLuint cornerVbo_;
+    GLShader instanceShader_;
+    ShaderUniforms instanceUniforms_;
+    bool instancing_;
+
+    // 数据流（偏移量均以字节计）
+    bool persistent_;
+    uint8_t* mappedBase_;       // 持久映射模式下整个环形缓冲区的基址
+    uint8_t* writePtr_;         // 当前批次在映射内存中的起始位置
+    BatchKind batchKind_;       // 当前批次的元素类型
+    size_t batchCount_;         // 当前批次已写入的元素数（四边形或实例）
+    size_t batchBytes_;         // 当前批次已写入的字节数
+    size_t segment_;            // 当前环形缓冲段
+    size_t segmentCursor_;      // 当前段（或孤立模式下整个缓冲区）已提交的字节数
+    GLsync fences_[RING_SEGMENTS];
+
+    // 纹理槽
+    uint32_t maxTextureSlots_;  // 实际可用槽数（受 GL_MAX_TEXTURE_IMAGE_UNITS 限制）
+    uint32_t slotCount_;
+    const Texture* slots_[MAX_TEXTURE_SLOTS];
     bool currentIsSDF_;
     glm::mat4 viewProjection_;
     
     uint32_t drawCallCount_;
     uint32_t spriteCount_;
+    uint32_t batchBreakCount_;
 
     void flush();
-    void setupShader();
+    bool setupShader();
+    bool compileShader(GLShader& shader, const char* vertexSource,
+                       const std::string& fragmentSource, ShaderUniforms& uniforms);
+    uint32_t acquireSlot(const Texture& texture);
+    void* reserve(BatchKind kind, const Texture& texture, bool isSDF, uint32_t& slot);
+    void drawVertices(const Texture& texture, const SpriteData& data);
+    void drawWideVertices(const Texture& texture, const SpriteData& data);
+    void drawInstance(const Texture& texture, const SpriteData& data);
+    bool initStreamBuffer();
+    void initInstanceArray();
+    void bindInstanceAttributes(size_t byteOffset);
+    void mapBatch();
+    void advanceSegment();
 };
 
 } // namespace easy2d
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <GL/glew.h>
+
+namespace easy2d {
+
+// ============================================================================
+// OpenGL 状态缓存 - 记录当前绑定的程序、VAO、纹理单元和混合状态，
+// 与缓存一致的绑定调用直接跳过。GL 后端只有一个上下文，因此全局共享一份。
+// 所有对这些状态的修改都必须经过缓存，否则缓存会与实际状态不一致；
+// 外部代码直接改动了 GL 状态时调用 invalidate()。
+// ============================================================================
+class GLStateCache {
+public:
+    static constexpr uint32_t MAX_TEXTURE_UNITS = 32;
+
+    static GLStateCache& instance();
+
+    // 禁止拷贝
+    GLStateCache(const GLStateCache&) = delete;
+    GLStateCache& operator=(const GLStateCache&) = delete;
+
+    // ------------------------------------------------------------------------
+    // 状态绑定（返回是否实际调用了 GL）
+    // ------------------------------------------------------------------------
+    bool useProgram(GLuint program);
+    bool bindVertexArray(GLuint vao);
+    bool bindTexture(uint32_t unit, GLuint texture);
+    // 上传/修改纹理前调用：保证纹理绑定在当前活动单元（单元 0）上
+    void bindTextureForUpload(GLuint texture);
+    void setBlend(bool enabled, GLenum srcFactor = GL_ONE, GLenum dstFactor = GL_ZERO);
+    // Alpha 通道使用单独的混合因子
+    void setBlend(bool enabled, GLenum srcFactor, GLenum dstFactor, GLenum srcAlpha, GLenum dstAlpha);
+
+    // ------------------------------------------------------------------------
+    // 对象删除时清除缓存，避免新对象复用同一 ID 时被误判为已绑定
+    // ------------------------------------------------------------------------
+    void forgetProgram(GLuint program);
+    void forgetVertexArray(GLuint vao);
+    void forgetTexture(GLuint texture);
+
+    // 将所有状态标记为未知，下一次绑定必定调用 GL
+    void invalidate();
+
+    // ------------------------------------------------------------------------
+    // 统计（实际发出的绑定调用）
+    // ------------------------------------------------------------------------
+    uint32_t getShaderBindCount() const { return shaderBinds_; }
+    uint32_t getTextureBindCount() const { return textureBinds_; }
+    void resetCounters();
+
+private:
+    GLStateCache();
+
+    // UNKNOWN 表示状态未知（初始或 invalidate 之后）
+    static constexpr GLuint UNKNOWN = 0xFFFFFFFFu;
+
+    GLuint program_;
+    GLuint vertexArray_;
+    uint32_t activeUnit_;
+    GLuint textures_[MAX_TEXTURE_UNITS];
+
+    int blendEnabled_;          // -1 未知，0 关闭，1 开启
+    GLenum blendSrc_;
+    GLenum blendDst_;
+    GLenum blendSrcAlpha_;
+    GLenum blendDstAlpha_;
+
+    uint32_t shaderBinds_;
+    uint32_t textureBinds_;
+};
+
+} // namespace easy2d
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <easy2d/graphics/static_sprite_buffer.h>
+#include <easy2d/graphics/opengl/gl_sprite_batch.h>
+#include <GL/glew.h>
+#include <vector>
+
+namespace easy2d {
+
+// ============================================================================
+// OpenGL 静态精灵缓冲区
+// 顶点格式与 GLSpriteBatch 相同（有纹理坐标超出 [0,1] 的精灵时整个缓冲区使用 WideVertex），
+// 按纹理分组连续存放（组的顺序为纹理首次出现的顺序，
+// 组内保持精灵的原始顺序），绘制时每组一次 glDrawElements
+// ============================================================================
+class GLStaticSpriteBuffer : public StaticSpriteBuffer {
+public:
+    // 一种纹理对应的索引范围
+    struct Range {
+        const Texture* texture;
+        GLsizei indexOffset;    // 以索引个数计
+        GLsizei indexCount;
+    };
+
+    GLStaticSpriteBuffer();
+    ~GLStaticSpriteBuffer() override;
+
+    GLStaticSpriteBuffer(const GLStaticSpriteBuffer&) = delete;
+    GLStaticSpriteBuffer& operator=(const GLStaticSpriteBuffer&) = delete;
+
+    void build(const std::vector<StaticSprite>& sprites) override;
+    size_t getSpriteCount() const override { return spriteCount_; }
+
+    GLuint getVertexArray() const { return vao_; }
+    const std::vector<Range>& getRanges() const { return ranges_; }
+
+private:
+    GLuint vao_;
+    GLuint vbo_;
+    GLuint ibo_;
+    size_t spriteCount_;
+    size_t indexCapacity_;      // 索引缓冲区已生成的四边形数
+    bool wide_;                 // 顶点属性当前按 WideVertex 设置
+
+    std::vector<Range> ranges_;
+
+    void createObjects();
+    template <typename VertexType>
+    void uploadVertices(const std::vector<GLSpriteBatch::SpriteData>& quads);
+};
+
+} // namespace easy2d
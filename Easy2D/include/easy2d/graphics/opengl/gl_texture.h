@@ -3,6 +3,7 @@
 #include <easy2d/graphics/texture.h>
 #include <easy2d/graphics/alpha_mask.h>
 #include <GL/glew.h>
+#include <atomic>
 #include <memory>
 
 namespace easy2d {
@@ -12,8 +13,15 @@ namespace easy2d {
 // ============================================================================
 class GLTexture : public Texture {
 public:
-    GLTexture(int width, int height, const uint8_t* pixels, int channels);
-    GLTexture(const std::string& filepath);
+    // 由 malloc / stbi_load 分配的像素缓冲区
+    using PixelBuffer = std::unique_ptr<uint8_t, void (*)(void*)>;
+
+    GLTexture(int width, int height, const uint8_t* pixels, int channels,
+              const TextureLoadOptions& options = {});
+    // 接管已解码的像素（异步加载时由工作线程解码），需要保留像素时不再复制
+    GLTexture(int width, int height, PixelBuffer pixels, int channels,
+              const TextureLoadOptions& options = {});
+    GLTexture(const std::string& filepath, const TextureLoadOptions& options = {});
     ~GLTexture();
 
     // Texture 接口实现
@@ -23,6 +31,7 @@ public:
     int getChannels() const override { return channels_; }
     void* getNativeHandle() const override { return reinterpret_cast<void*>(static_cast<uintptr_t>(textureID_)); }
     bool isValid() const override { return textureID_ != 0; }
+    size_t getMemoryUsage() const override;
     void setFilter(bool linear) override;
     void setWrap(bool repeat) override;
 
@@ -31,22 +40,41 @@ public:
     void bind(unsigned int slot = 0) const;
     void unbind() const;
 
+    // 单通道纹理按 (1, 1, 1, R) 采样：红色通道作为白色像素的 Alpha（如字形覆盖率）
+    void setCoverageSwizzle();
+
+    // 内存中保留的像素（仅在加载时指定 keepPixels 时有效）
+    const uint8_t* getPixels() const { return pixels_.get(); }
+    bool hasMipmaps() const { return mipmaps_; }
+
+    // 显存占用（字节）
+    size_t getGpuMemoryUsage() const { return gpuBytes_; }
+
     // Alpha 遮罩
     bool hasAlphaMask() const { return alphaMask_ != nullptr && alphaMask_->isValid(); }
-    const AlphaMask* getAlphaMask() const { return alphaMask_.get(); }
-    void generateAlphaMask();  // 从当前纹理数据生成遮罩
+    const AlphaMask* getAlphaMask() const override { return alphaMask_.get(); }
+    void generateAlphaMask();  // 从保留的像素生成遮罩（需要 keepPixels）
+    void setAlphaMask(AlphaMask mask) { alphaMask_ = std::make_unique<AlphaMask>(std::move(mask)); }
+
+    // 所有 GLTexture 当前占用的显存总量（字节）
+    static size_t getTotalGpuMemoryUsage() { return totalGpuBytes_.load(std::memory_order_relaxed); }
 
 private:
     GLuint textureID_;
     int width_;
     int height_;
     int channels_;
+    bool mipmaps_;
+    size_t gpuBytes_;
     
-    // 原始像素数据（用于生成遮罩）
-    std::vector<uint8_t> pixelData_;
+    // 原始像素数据（按需保留，用于生成遮罩）
+    PixelBuffer pixels_;
     std::unique_ptr<AlphaMask> alphaMask_;
 
+    static std::atomic<size_t> totalGpuBytes_;
+
     void createTexture(const uint8_t* pixels);
+    void retainPixels(const uint8_t* pixels, PixelBuffer owned, const TextureLoadOptions& options);
 };
 
 } // namespace easy2d
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <easy2d/graphics/texture_region.h>
+#include <easy2d/graphics/opengl/gl_texture.h>
+#include <stb/stb_rect_pack.h>
+#include <memory>
+#include <vector>
+
+namespace easy2d {
+
+// ============================================================================
+// OpenGL 运行时纹理图集 - 把小图片打包进若干张共享的 RGBA 页纹理
+// 使用 stb_rect_pack 增量打包，当前页放不下时新建一页
+// 打包器只增不减，单个区域释放后的空间不会复用；一页中的区域全部释放后整页回收
+// （新建页之前或 releaseUnusedPages 时）
+// ============================================================================
+class GLTextureAtlas {
+public:
+    explicit GLTextureAtlas(int pageSize = 2048);
+    ~GLTextureAtlas() = default;
+
+    GLTextureAtlas(const GLTextureAtlas&) = delete;
+    GLTextureAtlas& operator=(const GLTextureAtlas&) = delete;
+
+    // 添加一张图片，返回其在图集中的区域；放不下（超过页尺寸）时返回 nullptr
+    Ptr<TextureRegion> add(const uint8_t* pixels, int width, int height, int channels);
+
+    // 释放没有存活区域的页，返回释放的页数
+    size_t releaseUnusedPages();
+
+    int getPageSize() const { return pageSize_; }
+    size_t getPageCount() const { return pages_.size(); }
+
+private:
+    static constexpr int PADDING = 2;  // 区域之间的间距，避免采样时互相渗色
+
+    struct Page {
+        Ptr<GLTexture> texture;
+        stbrp_context context;
+        std::vector<stbrp_node> nodes;
+    };
+
+    int pageSize_;
+    std::vector<std::unique_ptr<Page>> pages_;
+
+    Page& createPage();
+    bool pack(Page& page, int width, int height, int& x, int& y);
+};
+
+} // namespace easy2d
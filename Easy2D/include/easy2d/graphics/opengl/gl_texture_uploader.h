@@ -0,0 +1,67 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <GL/glew.h>
+
+namespace easy2d {
+
+// ============================================================================
+// 纹理上传器 - 通过像素缓冲对象（PBO）环异步上传纹理数据
+// 像素先写入映射的 PBO，再由 glTexSubImage2D 从 PBO 读取，驱动可以在后台完成
+// 传输，CPU 不必等待拷贝结束。多次上传在同一个 PBO 中顺序分配，写满后插入
+// 栅栏并切换到下一个；只有环绕回来时该 PBO 仍被 GPU 使用才会等待。
+// 与 GLStateCache 一样全局共享一份，GL 上下文销毁前需调用 shutdown()。
+// ============================================================================
+class GLTextureUploader {
+public:
+    // 向映射内存写入 width * height 个紧密排列的像素
+    using FillFunc = Function<void(uint8_t* dst)>;
+
+    static GLTextureUploader& instance();
+
+    // 禁止拷贝
+    GLTextureUploader(const GLTextureUploader&) = delete;
+    GLTextureUploader& operator=(const GLTextureUploader&) = delete;
+
+    /// 将紧密排列的像素上传到纹理的 (x, y, width, height) 区域
+    /// format 为 GL_RED / GL_RG / GL_RGB / GL_RGBA，像素类型为 GL_UNSIGNED_BYTE
+    void upload(GLuint texture, int x, int y, int width, int height, GLenum format, const void* pixels);
+
+    /// 由 fill 直接写入 PBO 映射内存，省去调用方的中间缓冲（如格式转换、清零）
+    void upload(GLuint texture, int x, int y, int width, int height, GLenum format, const FillFunc& fill);
+
+    /// 禁用后退回客户端内存直接上传
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+    bool isEnabled() const { return enabled_; }
+
+    /// 释放所有 PBO 和栅栏
+    void shutdown();
+
+    /// 因 PBO 仍被 GPU 使用而等待的次数
+    uint32_t getStallCount() const { return stallCount_; }
+
+private:
+    GLTextureUploader() = default;
+
+    static constexpr size_t BUFFER_COUNT = 4;
+    static constexpr size_t BUFFER_SIZE = 4 * 1024 * 1024;
+    static constexpr size_t ALIGNMENT = 64;
+
+    struct Buffer {
+        GLuint id = 0;
+        size_t capacity = 0;
+        size_t offset = 0;      // 下一次分配的起点
+        GLsync fence = nullptr; // 切换走时插入，复用前等待
+    };
+
+    // 在当前 PBO 中分配 size 字节并绑定，返回映射地址（失败时返回 nullptr 且不绑定）
+    uint8_t* map(size_t size, size_t& offset);
+    void waitFence(Buffer& buffer);
+
+    Buffer buffers_[BUFFER_COUNT];
+    size_t current_ = 0;
+    bool enabled_ = true;
+    uint32_t stallCount_ = 0;
+};
+
+} // namespace easy2d
@@ -12,7 +12,10 @@ namespace easy2d {
 class Window;
 class Texture;
 class FontAtlas;
+class GlyphRun;
 class Shader;
+class StaticSpriteBuffer;
+class RenderTarget;
 
 // ============================================================================
 // 渲染后端类型
@@ -28,13 +31,21 @@ enum class BackendType {
 // ============================================================================
 // 混合模式
 // ============================================================================
-enum class BlendMode {
+enum class BlendMode : uint8_t {
     None,       // 不混合
     Alpha,      // 标准 Alpha 混合
     Additive,   // 加法混合
     Multiply    // 乘法混合
 };
 
+// ============================================================================
+// 精灵提交路径
+// ============================================================================
+enum class SpriteRenderPath : uint8_t {
+    Vertices,   // CPU 展开四边形，每个精灵 4 个顶点
+    Instanced   // 每个精灵 1 条实例记录，GPU 展开四边形
+};
+
 // ============================================================================
 // 渲染后端抽象接口
 // ============================================================================
@@ -56,6 +67,18 @@ public:
     virtual void setViewport(int x, int y, int width, int height) = 0;
     virtual void setVSync(bool enabled) = 0;
 
+    // 清除当前渲染目标
+    virtual void clear(const Color& color) = 0;
+
+    // ------------------------------------------------------------------------
+    // 渲染目标
+    // ------------------------------------------------------------------------
+    virtual Ptr<RenderTarget> createRenderTarget(int width, int height) = 0;
+    // 之后的绘制输出到 target（nullptr 为窗口）；切换时提交已累积的批次，
+    // 视口设为目标大小，切回窗口时恢复 setViewport 设置的视口
+    virtual void setRenderTarget(Ptr<RenderTarget> target) = 0;
+    virtual Ptr<RenderTarget> getRenderTarget() const = 0;
+
     // ------------------------------------------------------------------------
     // 状态设置
     // ------------------------------------------------------------------------
@@ -83,6 +106,16 @@ public:
                            const Color& tint) = 0;
     virtual void endSpriteBatch() = 0;
 
+    virtual void setSpriteRenderPath(SpriteRenderPath path) = 0;
+    virtual SpriteRenderPath getSpriteRenderPath() const = 0;
+
+    // ------------------------------------------------------------------------
+    // 静态精灵（几何常驻 GPU，每帧只需按纹理发出绘制调用）
+    // ------------------------------------------------------------------------
+    virtual Ptr<StaticSpriteBuffer> createStaticSpriteBuffer() = 0;
+    // transform 在视图投影之前作用于缓冲区中的顶点（模型变换）
+    virtual void drawStaticSprites(const StaticSpriteBuffer& buffer, const glm::mat4& transform) = 0;
+
     // ------------------------------------------------------------------------
     // 形状渲染
     // ------------------------------------------------------------------------
@@ -102,6 +135,8 @@ public:
     virtual Ptr<FontAtlas> createFontAtlas(const std::string& filepath, int fontSize, bool useSDF = false) = 0;
     virtual void drawText(const FontAtlas& font, const String& text, const Vec2& position, const Color& color) = 0;
     virtual void drawText(const FontAtlas& font, const String& text, float x, float y, const Color& color) = 0;
+    // 绘制已排版的字形串，position 为文字左上角
+    virtual void drawGlyphRun(const GlyphRun& run, const Vec2& position, const Color& color) = 0;
 
     // ------------------------------------------------------------------------
     // 统计信息
@@ -109,8 +144,11 @@ public:
     struct Stats {
         uint32_t drawCalls = 0;
         uint32_t triangleCount = 0;
-        uint32_t textureBinds = 0;
-        uint32_t shaderBinds = 0;
+        uint32_t textureBinds = 0;      // 实际发出的纹理绑定（跳过重复绑定后）
+        uint32_t shaderBinds = 0;       // 实际发出的着色器切换
+        uint32_t spriteBatches = 0;     // 精灵批次数
+        uint32_t batchBreaks = 0;       // 批次内被迫中断的次数（纹理槽用尽、SDF 切换、缓冲区写满）
+        size_t textureMemory = 0;       // 所有纹理当前占用的显存（字节）
     };
     virtual Stats getStats() const = 0;
     virtual void resetStats() = 0;
@@ -3,20 +3,22 @@
 #include <easy2d/core/types.h>
 #include <easy2d/core/math_types.h>
 #include <easy2d/core/color.h>
-#include <easy2d/core/string.h>
-#include <variant>
-#include <vector>
+#include <easy2d/graphics/render_backend.h>
+#include <type_traits>
 
 namespace easy2d {
 
 // 前向声明
 class Texture;
 class FontAtlas;
+class GlyphRun;
+class String;
+class Node;
 
 // ============================================================================
 // 渲染命令类型
 // ============================================================================
-enum class RenderCommandType {
+enum class RenderCommandType : uint8_t {
     Sprite,
     Line,
     Rect,
@@ -27,14 +29,17 @@ enum class RenderCommandType {
     FilledTriangle,
     Polygon,
     FilledPolygon,
-    Text
+    Text,
+    Custom      // 节点自定义绘制（回调 Node::onDraw）
 };
 
 // ============================================================================
-// 精灵数据
+// 命令负载 - 全部为平凡可复制类型，存放在 RenderQueue 的每帧内存池中
+// 纹理、字体、文字等对象只保存裸指针，由生成命令的节点保证在提交前有效
 // ============================================================================
+
+// 精灵数据（纹理由命令的 textureIndex 指定）
 struct SpriteData {
-    Ptr<Texture> texture;
     Rect destRect;
     Rect srcRect;
     Color tint;
@@ -42,9 +47,7 @@ struct SpriteData {
     Vec2 anchor;
 };
 
-// ============================================================================
 // 直线数据
-// ============================================================================
 struct LineData {
     Vec2 start;
     Vec2 end;
@@ -52,18 +55,14 @@ struct LineData {
     float width;
 };
 
-// ============================================================================
 // 矩形数据
-// ============================================================================
 struct RectData {
     Rect rect;
     Color color;
     float width;
 };
 
-// ============================================================================
 // 圆形数据
-// ============================================================================
 struct CircleData {
     Vec2 center;
     float radius;
@@ -72,9 +71,7 @@ struct CircleData {
     float width;
 };
 
-// ============================================================================
 // 三角形数据
-// ============================================================================
 struct TriangleData {
     Vec2 p1;
     Vec2 p2;
@@ -83,46 +80,47 @@ struct TriangleData {
     float width;
 };
 
-// ============================================================================
-// 多边形数据
-// ============================================================================
+// 多边形数据（顶点存放在内存池中）
 struct PolygonData {
-    std::vector<Vec2> points;
+    uint32_t pointOffset;
+    uint32_t pointCount;
     Color color;
     float width;
 };
 
-// ============================================================================
 // 文字数据
-// ============================================================================
 struct TextData {
-    Ptr<FontAtlas> font;
-    String text;
+    FontAtlas* font;
+    const String* text;
+    const GlyphRun* run;    // 节点缓存的排版结果，非空时直接绘制，忽略 text
     Vec2 position;
     Color color;
+    Vec2 size;          // 文字尺寸（用于计算遮挡关系）
+};
+
+// 自定义绘制数据 - 未生成具体命令的节点在提交时回调其 onDraw
+struct CustomData {
+    Node* node;
+    Rect bounds;        // 绘制范围，为空表示未知（作为排序屏障）
 };
 
 // ============================================================================
-// 渲染命令
+// 渲染命令 - 紧凑的 POD 结构，负载通过偏移量指向每帧内存池
 // ============================================================================
 struct RenderCommand {
+    uint64_t sortKey;           // 由 RenderQueue::sort 填写
+    uint32_t payloadOffset;     // 负载在内存池中的偏移
+    uint32_t textureIndex;      // 每帧纹理表中的索引，0 表示无纹理（形状）
+    int32_t zOrder;
     RenderCommandType type;
-    int zOrder;
-
-    std::variant<
-        SpriteData,
-        LineData,
-        RectData,
-        CircleData,
-        TriangleData,
-        PolygonData,
-        TextData
-    > data;
-
-    // 用于排序
-    bool operator<(const RenderCommand& other) const {
-        return zOrder < other.zOrder;
-    }
+    BlendMode blendMode;
+    uint8_t shaderId;           // 0 为默认的精灵/形状批处理管线
 };
 
+static_assert(std::is_trivially_copyable_v<RenderCommand>, "RenderCommand must be trivially copyable");
+static_assert(std::is_trivially_copyable_v<SpriteData>, "SpriteData must be trivially copyable");
+static_assert(std::is_trivially_copyable_v<PolygonData>, "PolygonData must be trivially copyable");
+static_assert(std::is_trivially_copyable_v<TextData>, "TextData must be trivially copyable");
+static_assert(std::is_trivially_copyable_v<CustomData>, "CustomData must be trivially copyable");
+
 } // namespace easy2d
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <easy2d/core/math_types.h>
+#include <easy2d/graphics/render_command.h>
+#include <cstring>
+#include <vector>
+
+namespace easy2d {
+
+// 前向声明
+class RenderBackend;
+class Texture;
+
+// ============================================================================
+// 渲染队列 - 收集场景树的渲染命令，排序后一次性提交给渲染后端
+//
+// 命令为平凡可复制的定长结构，负载写入每帧复用的内存池，纹理登记到每帧
+// 纹理表中，因此容量稳定后收集、排序、提交全程不再分配内存。
+//
+// 排序键（64 位，高位优先）：
+//   layer(16) | blend(2) | shader(4) | texture(16) | sequence(26)
+//
+// layer 由命令间的遮挡关系推导：一条命令只需排在与它重叠的先前命令之后，
+// 互不重叠的命令落在同一层，层内可按混合模式/着色器/纹理自由重排以合并批次。
+// 绘制范围未知的自定义命令作为屏障，前后命令不会跨越它重排。
+// 排序使用按字节的 LSD 基数排序，所有键该字节相同时跳过该趟。
+// ============================================================================
+class RenderQueue {
+public:
+    static constexpr uint32_t MAX_LAYER = 0xFFFF;
+    static constexpr uint32_t MAX_SEQUENCE = (1u << 26) - 1;
+
+    RenderQueue();
+
+    // ------------------------------------------------------------------------
+    // 命令收集
+    // ------------------------------------------------------------------------
+    void clear();
+
+    // 添加一条命令，负载复制到内存池
+    template <typename T>
+    void push(RenderCommandType type, int zOrder, const T& payload,
+              const Texture* texture = nullptr, BlendMode blendMode = BlendMode::Alpha) {
+        static_assert(std::is_trivially_copyable_v<T>, "render payload must be trivially copyable");
+        RenderCommand cmd;
+        cmd.sortKey = 0;
+        cmd.payloadOffset = allocate(sizeof(T));
+        cmd.textureIndex = registerTexture(texture);
+        cmd.zOrder = zOrder;
+        cmd.type = type;
+        cmd.blendMode = blendMode;
+        cmd.shaderId = 0;
+        std::memcpy(arena_.data() + cmd.payloadOffset, &payload, sizeof(T));
+        commands_.push_back(cmd);
+    }
+
+    // 在内存池中分配多边形顶点，返回的指针在下一次分配前有效
+    Vec2* allocatePoints(size_t count, uint32_t& offset);
+
+    // 按顺序追加另一个队列的全部命令（用于合并各线程的收集结果）
+    void append(const RenderQueue& other);
+
+    const std::vector<RenderCommand>& getCommands() const { return commands_; }
+    size_t size() const { return commands_.size(); }
+    bool empty() const { return commands_.empty(); }
+
+    template <typename T>
+    const T& getPayload(const RenderCommand& command) const {
+        return *reinterpret_cast<const T*>(arena_.data() + command.payloadOffset);
+    }
+    const Vec2* getPoints(uint32_t offset) const {
+        return reinterpret_cast<const Vec2*>(arena_.data() + offset);
+    }
+    const Texture* getTexture(const RenderCommand& command) const { return textures_[command.textureIndex]; }
+
+    // ------------------------------------------------------------------------
+    // 排序与提交
+    // ------------------------------------------------------------------------
+    void sort();
+    void submit(RenderBackend& renderer);
+
+    // 上一次排序得到的层数
+    uint32_t getLayerCount() const { return layerCount_; }
+
+private:
+    std::vector<RenderCommand> commands_;
+    std::vector<uint8_t> arena_;
+    size_t arenaSize_ = 0;
+
+    // 每帧纹理表：textures_[0] 固定为空，textureSlots_ 为开放寻址哈希（指针 -> 索引）
+    std::vector<const Texture*> textures_;
+    std::vector<const Texture*> textureKeys_;
+    std::vector<uint32_t> textureSlots_;
+
+    // 排序时的临时数据（跨帧复用容量）
+    std::vector<uint64_t> keys_;
+    std::vector<uint64_t> keysTemp_;
+    std::vector<Rect> bounds_;
+    std::vector<uint8_t> bounded_;
+    std::vector<uint16_t> layers_;
+    std::vector<int32_t> grid_;
+    std::vector<Vec2> polygonScratch_;
+
+    uint32_t layerCount_ = 0;
+    bool sorted_ = false;
+
+    uint32_t allocate(size_t bytes);
+    uint32_t registerTexture(const Texture* texture);
+    void growTextureTable();
+    void assignLayers();
+    void radixSort();
+
+    bool computeBounds(const RenderCommand& command, Rect& bounds) const;
+    void execute(const RenderCommand& command, RenderBackend& renderer);
+};
+
+} // namespace easy2d
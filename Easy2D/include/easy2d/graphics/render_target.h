@@ -0,0 +1,27 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+
+namespace easy2d {
+
+class Texture;
+
+// ============================================================================
+// 离屏渲染目标 - 由 RenderBackend::createRenderTarget 创建
+// 绑定后的绘制输出到颜色纹理，纹理方向与普通图片纹理一致（第 0 行为画面顶部），
+// 可以直接作为精灵绘制
+// ============================================================================
+class RenderTarget {
+public:
+    virtual ~RenderTarget() = default;
+
+    virtual int getWidth() const = 0;
+    virtual int getHeight() const = 0;
+
+    // 颜色附件
+    virtual Ptr<Texture> getTexture() const = 0;
+
+    virtual bool isValid() const = 0;
+};
+
+} // namespace easy2d
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <easy2d/core/color.h>
+#include <easy2d/core/math_types.h>
+#include <vector>
+
+namespace easy2d {
+
+class Texture;
+
+// ============================================================================
+// 静态精灵描述（参数含义与 RenderBackend::drawSprite 相同，rotation 为角度）
+// ============================================================================
+struct StaticSprite {
+    const Texture* texture = nullptr;
+    Rect destRect;
+    Rect srcRect;
+    Color tint = Colors::White;
+    float rotation = 0.0f;
+    Vec2 anchor;
+};
+
+// ============================================================================
+// 静态精灵缓冲区接口 - 几何一次性上传到 GPU 并常驻，内容变化时整体重建
+// 由 RenderBackend::createStaticSpriteBuffer 创建，RenderBackend::drawStaticSprites 绘制
+// 缓冲区只保存纹理裸指针，调用者需保证纹理在缓冲区使用期间有效
+// ============================================================================
+class StaticSpriteBuffer {
+public:
+    virtual ~StaticSpriteBuffer() = default;
+
+    // 用给定的精灵重建缓冲区（需在渲染线程调用）
+    virtual void build(const std::vector<StaticSprite>& sprites) = 0;
+
+    virtual size_t getSpriteCount() const = 0;
+};
+
+} // namespace easy2d
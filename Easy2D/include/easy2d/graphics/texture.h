@@ -5,6 +5,17 @@
 
 namespace easy2d {
 
+class AlphaMask;
+
+// ============================================================================
+// 纹理加载选项 - 默认只在显存中保留一份数据
+// ============================================================================
+struct TextureLoadOptions {
+    bool keepPixels = false;        // 在内存中保留像素副本（之后可随时生成 Alpha 遮罩）
+    bool keepAlphaMask = false;     // 加载时生成 1 位 Alpha 遮罩，不保留像素
+    bool mipmaps = false;           // 生成 mipmap（缩小显示时使用，额外占用约 1/3 显存）
+};
+
 // ============================================================================
 // 纹理接口
 // ============================================================================
@@ -25,12 +36,23 @@ public:
     
     // 是否有效
     virtual bool isValid() const = 0;
+
+    // 占用的字节数（显存与内存中保留的数据之和，图集区域不单独计算）
+    virtual size_t getMemoryUsage() const = 0;
     
     // 设置过滤模式
     virtual void setFilter(bool linear) = 0;
     
     // 设置环绕模式
     virtual void setWrap(bool repeat) = 0;
+
+    // 实际保存像素数据的纹理，以及本纹理左上角在其中的偏移（像素）
+    // 普通纹理返回自身；图集区域返回所在的图集页，渲染时据此换算纹理坐标并合批
+    virtual const Texture& getSourceTexture() const { return *this; }
+    virtual Vec2 getSourceOffset() const { return Vec2(0.0f, 0.0f); }
+
+    // Alpha 遮罩（加载时未生成遮罩则返回 nullptr）
+    virtual const AlphaMask* getAlphaMask() const { return nullptr; }
 };
 
 } // namespace easy2d
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <easy2d/graphics/texture.h>
+
+namespace easy2d {
+
+// ============================================================================
+// 纹理区域 - 引用另一张纹理（通常是图集页）中的一块矩形区域
+// 对外表现为一张独立的纹理，尺寸为区域大小；精灵和渲染器绘制时会换算到所在的
+// 页纹理上，因此同一页中的区域可以在一个批次中绘制
+// ============================================================================
+class TextureRegion : public Texture {
+public:
+    // region 为页纹理中的像素矩形（左上角为原点）
+    TextureRegion(Ptr<Texture> page, const Rect& region);
+    ~TextureRegion() override = default;
+
+    static Ptr<TextureRegion> create(Ptr<Texture> page, const Rect& region);
+
+    // Texture 接口实现
+    int getWidth() const override { return static_cast<int>(region_.width()); }
+    int getHeight() const override { return static_cast<int>(region_.height()); }
+    Size getSize() const override { return region_.size; }
+    int getChannels() const override;
+    void* getNativeHandle() const override;
+    bool isValid() const override;
+    size_t getMemoryUsage() const override { return 0; }
+
+    // 过滤模式作用于整张页纹理；区域无法单独设置环绕模式，调用将被忽略
+    void setFilter(bool linear) override;
+    void setWrap(bool repeat) override;
+
+    const Texture& getSourceTexture() const override;
+    Vec2 getSourceOffset() const override;
+
+    // 区域信息
+    Ptr<Texture> getPage() const { return page_; }
+    const Rect& getRegion() const { return region_; }
+
+private:
+    Ptr<Texture> page_;
+    Rect region_;
+};
+
+} // namespace easy2d
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <easy2d/graphics/texture.h>
+#include <easy2d/graphics/font.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace easy2d {
+
+// ============================================================================
+// 资源包 - 加载 easy2d_cook 离线生成的二进制资源包
+// 文件通过内存映射读取，图集页的像素数据直接上传到 GPU，不需要解码图片；
+// 包中的图片以 TextureRegion 的形式提供，字体为预光栅化的字形集合
+// ============================================================================
+class AssetBundle {
+public:
+    // 预光栅化的字体
+    struct FontInfo {
+        std::string name;       // 原字体文件路径
+        int fontSize;
+        bool useSDF;
+        Ptr<FontAtlas> font;
+    };
+
+    AssetBundle() = default;
+    ~AssetBundle() = default;
+
+    AssetBundle(const AssetBundle&) = delete;
+    AssetBundle& operator=(const AssetBundle&) = delete;
+
+    // 加载资源包，失败时返回 nullptr
+    static Ptr<AssetBundle> load(const std::string& filepath);
+
+    const std::string& getPath() const { return path_; }
+
+    // 按原图片路径查找纹理
+    Ptr<Texture> getTexture(const std::string& name) const;
+    const std::unordered_map<std::string, Ptr<Texture>>& getTextures() const { return textures_; }
+
+    const std::vector<FontInfo>& getFonts() const { return fonts_; }
+
+    size_t getPageCount() const { return pages_.size(); }
+
+private:
+    std::string path_;
+    std::vector<Ptr<Texture>> pages_;
+    std::unordered_map<std::string, Ptr<Texture>> textures_;
+    std::vector<FontInfo> fonts_;
+
+    bool parse(const uint8_t* data, size_t size);
+};
+
+} // namespace easy2d
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+
+namespace easy2d {
+namespace bundle {
+
+// ============================================================================
+// 资源包二进制格式（easy2d_cook 生成，AssetBundle 读取）
+//
+// 文件布局（小端序）：
+//   Header
+//   PageEntry[pageCount]
+//   RegionEntry[regionCount]
+//   FontEntry[fontCount]
+//   GlyphEntry[glyphCount]
+//   字符串表（UTF-8，不以 0 结尾）
+//   页像素数据（按 DATA_ALIGNMENT 对齐，行序与 glTexImage2D 一致，可直接上传）
+// ============================================================================
+
+constexpr char MAGIC[4] = { 'E', '2', 'D', 'B' };
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t DATA_ALIGNMENT = 16;
+
+// 页像素格式
+enum class PixelFormat : uint32_t {
+    RGBA8 = 0,
+    R8 = 1,
+};
+
+// 字体标志
+constexpr uint32_t FONT_FLAG_SDF = 1u << 0;
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t pageCount;
+    uint32_t regionCount;
+    uint32_t fontCount;
+    uint32_t glyphCount;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+};
+
+// 一张图集页
+struct PageEntry {
+    uint32_t width;
+    uint32_t height;
+    PixelFormat format;
+    uint32_t reserved;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+};
+
+// 图片在页中的区域（像素，左上角为原点），name 为运行时 loadTexture 使用的路径
+struct RegionEntry {
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t page;
+    uint32_t reserved;
+    float x;
+    float y;
+    float width;
+    float height;
+};
+
+// 预光栅化的字体，name 为运行时 loadFont 使用的路径
+struct FontEntry {
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t page;
+    int32_t fontSize;
+    uint32_t flags;
+    float ascent;
+    float descent;
+    float lineGap;
+    uint32_t firstGlyph;
+    uint32_t glyphCount;
+};
+
+// 字形，字段含义与 Glyph 相同
+struct GlyphEntry {
+    uint32_t codepoint;
+    float u0, v0;
+    float u1, v1;
+    float width;
+    float height;
+    float bearingX;
+    float bearingY;
+    float advance;
+};
+
+static_assert(sizeof(Header) == 40, "bundle::Header layout changed");
+static_assert(sizeof(PageEntry) == 32, "bundle::PageEntry layout changed");
+static_assert(sizeof(RegionEntry) == 32, "bundle::RegionEntry layout changed");
+static_assert(sizeof(FontEntry) == 40, "bundle::FontEntry layout changed");
+static_assert(sizeof(GlyphEntry) == 40, "bundle::GlyphEntry layout changed");
+
+} // namespace bundle
+} // namespace easy2d
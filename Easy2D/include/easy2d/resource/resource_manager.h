@@ -12,6 +12,11 @@
 
 namespace easy2d {
 
+class GLTextureAtlas;
+class AssetBundle;
+class ThreadPool;
+class TextureHandle;
+
 // ============================================================================
 // 资源管理器 - 统一管理纹理、字体、音效等资源
 // ============================================================================
@@ -45,8 +50,8 @@ public:
     // 纹理资源
     // ------------------------------------------------------------------------
     
-    /// 加载纹理（带缓存）
-    Ptr<Texture> loadTexture(const std::string& filepath);
+    /// 加载纹理（带缓存，已缓存时忽略 options）
+    Ptr<Texture> loadTexture(const std::string& filepath, const TextureLoadOptions& options = {});
     
     /// 加载纹理并生成Alpha遮罩（用于不规则形状图片）
     Ptr<Texture> loadTextureWithAlphaMask(const std::string& filepath);
@@ -59,6 +64,39 @@ public:
     
     /// 卸载指定纹理
     void unloadTexture(const std::string& key);
+
+    // ------------------------------------------------------------------------
+    // 异步纹理加载
+    // ------------------------------------------------------------------------
+
+    /// 异步加载纹理：图片在线程池中解码，GL 上传推迟到主线程的 processAsyncUploads
+    /// 已缓存时返回的句柄立即就绪；同一路径正在加载时返回同一个句柄
+    Ptr<TextureHandle> loadTextureAsync(const std::string& filepath, const TextureLoadOptions& options = {});
+
+    /// 上传已解码的纹理并完成对应句柄，本次上传量达到 byteBudget 后停止（至少处理一张）
+    /// 必须在主线程调用，Application 每帧调用一次；返回处理的纹理数量
+    size_t processAsyncUploads(size_t byteBudget);
+
+    /// 正在解码或等待上传的纹理数量
+    size_t getPendingTextureCount() const;
+
+    /// 设置解码使用的线程池，为空时在调用线程中解码
+    void setThreadPool(ThreadPool* pool);
+
+    // ------------------------------------------------------------------------
+    // 纹理图集
+    // ------------------------------------------------------------------------
+
+    /// 启用/禁用运行时纹理图集
+    /// 启用后，宽高均不超过 maxImageSize 的图片会被打包进 pageSize 大小的共享图集页，
+    /// loadTexture 返回 TextureRegion，同一页中的图片可以在一个批次中绘制
+    void setTextureAtlasEnabled(bool enabled, int pageSize = 2048, int maxImageSize = 256);
+
+    /// 是否启用了纹理图集
+    bool isTextureAtlasEnabled() const;
+
+    /// 当前图集页数量
+    size_t getTextureAtlasPageCount() const;
     
     // ------------------------------------------------------------------------
     // Alpha遮罩资源
@@ -79,6 +117,12 @@ public:
     
     /// 加载字体图集（带缓存）
     Ptr<FontAtlas> loadFont(const std::string& filepath, int fontSize, bool useSDF = false);
+
+    /// 设置动态字形图集的页大小、页数上限、淘汰间隔和字形磁盘缓存目录，作用于之后加载的字体
+    void setFontAtlasConfig(const FontAtlasConfig& config);
+
+    /// 在线程池中预光栅化 text 中的字符（如对话框的字符串表），需在主线程调用
+    void prewarmFont(const Ptr<FontAtlas>& font, const String& text);
     
     /// 通过key获取已缓存的字体图集
     Ptr<FontAtlas> getFont(const std::string& key) const;
@@ -106,11 +150,22 @@ public:
     /// 卸载指定音效
     void unloadSound(const std::string& key);
 
+    // ------------------------------------------------------------------------
+    // 资源包
+    // ------------------------------------------------------------------------
+
+    /// 加载 easy2d_cook 离线生成的资源包，包中的图片和字体按原文件路径登记到缓存，
+    /// 之后用相同路径调用 loadTexture / loadFont 即可直接命中，不再解码图片
+    bool loadBundle(const std::string& filepath);
+
+    /// 卸载所有资源包（仍在使用的资源不受影响）
+    void unloadBundles();
+
     // ------------------------------------------------------------------------
     // 缓存清理
     // ------------------------------------------------------------------------
     
-    /// 清理所有失效的弱引用（自动清理已释放的资源）
+    /// 清理所有失效的弱引用（自动清理已释放的资源），并释放区域已全部释放的纹理图集页
     void purgeUnused();
     
     /// 清理指定类型的所有缓存
@@ -131,6 +186,16 @@ public:
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
 
+    // 尝试把图片打包进图集，不满足条件或失败时返回 nullptr
+    Ptr<Texture> loadTextureIntoAtlas(const std::string& fullPath);
+
+    // 异步加载中已解码、等待上传的图片
+    struct DecodedImage;
+    struct AsyncUploadQueue;
+
+    // 在主线程中为已解码的图片创建纹理（调用时持有 textureMutex_）
+    Ptr<Texture> createDecodedTexture(DecodedImage& image);
+
     // 生成字体缓存key
     std::string makeFontKey(const std::string& filepath, int fontSize, bool useSDF) const;
     
@@ -138,6 +203,7 @@ public:
     mutable std::mutex textureMutex_;
     mutable std::mutex fontMutex_;
     mutable std::mutex soundMutex_;
+    mutable std::mutex bundleMutex_;
     
     // 搜索路径
     std::vector<std::string> searchPaths_;
@@ -146,6 +212,20 @@ public:
     std::unordered_map<std::string, WeakPtr<Texture>> textureCache_;
     std::unordered_map<std::string, WeakPtr<FontAtlas>> fontCache_;
     std::unordered_map<std::string, WeakPtr<Sound>> soundCache_;
+
+    // 纹理图集
+    bool atlasEnabled_ = false;
+    int atlasPageSize_ = 2048;
+    int atlasMaxImageSize_ = 256;
+    UniquePtr<GLTextureAtlas> atlas_;
+
+    // 已加载的资源包（持有包中资源的强引用）
+    std::vector<Ptr<AssetBundle>> bundles_;
+
+    // 异步纹理加载 - 上传队列与解码任务共享，资源管理器先于线程池销毁时仍可安全写入
+    ThreadPool* threadPool_ = nullptr;
+    Ptr<AsyncUploadQueue> uploadQueue_;
+    std::unordered_map<std::string, Ptr<TextureHandle>> pendingTextures_;
 };
 
 } // namespace easy2d
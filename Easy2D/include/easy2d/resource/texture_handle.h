@@ -0,0 +1,54 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <easy2d/graphics/texture.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace easy2d {
+
+// ============================================================================
+// 纹理句柄 - ResourceManager::loadTextureAsync 的返回值
+// 图片在工作线程中解码，GL 上传在主线程按帧预算进行；上传完成前 getTexture
+// 返回占位纹理（未设置时为 nullptr），完成后回调在主线程中执行
+// ============================================================================
+class TextureHandle {
+public:
+    enum class State {
+        Pending,  // 正在解码或等待上传
+        Ready,    // 纹理可用
+        Failed    // 文件不存在或解码失败
+    };
+
+    using Callback = Function<void(Ptr<Texture>)>;
+
+    explicit TextureHandle(std::string path);
+
+    const std::string& getPath() const { return path_; }
+    State getState() const { return state_.load(std::memory_order_acquire); }
+    bool isPending() const { return getState() == State::Pending; }
+    bool isReady() const { return getState() == State::Ready; }
+    bool isFailed() const { return getState() == State::Failed; }
+
+    /// 加载完成后的纹理；未完成或失败时返回占位纹理
+    Ptr<Texture> getTexture() const;
+
+    /// 设置未完成时 getTexture 返回的占位纹理
+    void setPlaceholder(Ptr<Texture> placeholder) { placeholder_ = std::move(placeholder); }
+
+    /// 注册完成回调（成功时参数为纹理，失败时为 nullptr）；已完成时立即调用
+    void onLoaded(Callback callback);
+
+    /// 由 ResourceManager 在主线程调用
+    void complete(Ptr<Texture> texture);
+
+private:
+    std::string path_;
+    std::atomic<State> state_{ State::Pending };
+    Ptr<Texture> texture_;
+    Ptr<Texture> placeholder_;
+    std::vector<Callback> callbacks_;
+};
+
+} // namespace easy2d
@@ -16,6 +16,7 @@ namespace easy2d {
 class Scene;
 class Action;
 class RenderBackend;
+class RenderQueue;
 struct RenderCommand;
 
 // ============================================================================
@@ -26,6 +27,9 @@ public:
     Node();
     virtual ~Node();
 
+    // 创建分组节点：只容纳子节点，自身不绘制，不生成渲染命令
+    static Ptr<Node> create();
+
     // ------------------------------------------------------------------------
     // 层级管理
     // ------------------------------------------------------------------------
@@ -104,6 +108,9 @@ public:
     // 边界框（用于空间索引）
     // ------------------------------------------------------------------------
     virtual Rect getBoundingBox() const;
+
+    // 点击检测（默认判断点是否在边界框内）
+    virtual bool hitTest(const Vec2& point) const;
     
     // 是否需要参与空间索引（默认 true）
     void setSpatialIndexed(bool indexed) { spatialIndexed_ = indexed; }
@@ -112,6 +119,11 @@ public:
     // 更新空间索引（手动调用，通常在边界框变化后）
     void updateSpatialIndex();
 
+    // 视锥剔除（场景开启剔除时生效）：关闭后节点总是参与渲染，
+    // 用于没有有效边界框、或边界框不能反映实际绘制范围的节点
+    void setCullingEnabled(bool enabled) { cullingEnabled_ = enabled; }
+    bool isCullingEnabled() const { return cullingEnabled_; }
+
     // ------------------------------------------------------------------------
     // 动作系统
     // ------------------------------------------------------------------------
@@ -133,18 +145,31 @@ public:
     void update(float dt);
     void render(RenderBackend& renderer);
     void sortChildren();
+    void sortChildrenIfDirty();
     
     bool isRunning() const { return running_; }
     Scene* getScene() const { return scene_; }
 
-    // 多线程渲染命令收集
-    virtual void collectRenderCommands(std::vector<RenderCommand>& commands, int parentZOrder = 0);
+    // 标记节点在本次剔除查询中可见
+    void markVisible(uint32_t cullStamp) { visibleStamp_ = cullStamp; }
+    bool isCulled() const;
+
+    // 渲染命令收集：按绘制顺序（子节点按 zOrder 排序）递归收集整棵子树
+    // 场景开启并行收集时会在工作线程中调用，generateRenderCommand 不得调用 GL
+    virtual void collectRenderCommands(RenderQueue& queue, int parentZOrder = 0);
 
 protected:
     // 子类重写
     virtual void onDraw(RenderBackend& renderer) {}
     virtual void onUpdateNode(float dt) {}
-    virtual void generateRenderCommand(std::vector<RenderCommand>& commands, int zOrder) {};
+    // 生成本节点的渲染命令；默认生成回调 onDraw 的自定义命令（drawsContent() 为 false 时不生成）
+    virtual void generateRenderCommand(RenderQueue& queue, int zOrder);
+    // 默认为 true；引擎自身的分组节点（Node::create、Scene）关闭，
+    // 省去无谓的排序屏障和混合状态切换
+    bool drawsContent() const { return drawsContent_; }
+    void setDrawsContent(bool draws) { drawsContent_ = draws; }
+    // 子节点被添加或移除后回调
+    virtual void onChildrenChanged() {}
 
     // 供子类访问的内部状态
     Vec2& getPositionRef() { return position_; }
@@ -154,6 +179,8 @@ protected:
     float getOpacityRef() { return opacity_; }
 
 private:
+    friend class RenderQueue;
+
     // 层级
     WeakPtr<Node> parent_;
     std::vector<Ptr<Node>> children_;
@@ -172,7 +199,9 @@ private:
     // 缓存
     mutable bool transformDirty_ = true;
     mutable glm::mat4 localTransform_;
-    mutable glm::mat4 worldTransform_;
+
+    // 按当前位置、旋转、斜切、缩放和锚点计算本地变换，不修改缓存
+    glm::mat4 computeLocalTransform() const;
 
     // 元数据
     std::string name_;
@@ -183,6 +212,9 @@ private:
     Scene* scene_ = nullptr;
     bool spatialIndexed_ = true;  // 是否参与空间索引
     Rect lastSpatialBounds_;      // 上一次的空间索引边界（用于检测变化）
+    bool cullingEnabled_ = true;  // 是否参与视锥剔除
+    uint32_t visibleStamp_ = 0;   // 最近一次被剔除查询判定为可见的标记
+    bool drawsContent_ = true;    // 是否生成回调 onDraw 的自定义命令
 
     // 动作
     std::vector<Ptr<Action>> actions_;
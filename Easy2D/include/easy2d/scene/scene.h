@@ -3,6 +3,7 @@
 #include <easy2d/scene/node.h>
 #include <easy2d/core/color.h>
 #include <easy2d/graphics/camera.h>
+#include <easy2d/graphics/render_queue.h>
 #include <easy2d/spatial/spatial_manager.h>
 #include <vector>
 
@@ -58,7 +59,25 @@ public:
     void renderScene(RenderBackend& renderer);
     void renderContent(RenderBackend& renderer);
     void updateScene(float dt);
-    void collectRenderCommands(std::vector<RenderCommand>& commands);
+    void collectRenderCommands(RenderQueue& queue);
+
+    // 场景树经渲染队列收集、排序后批量提交（而非逐节点立即绘制）
+    void onRender(RenderBackend& renderer) override;
+
+    RenderQueue& getRenderQueue() { return renderQueue_; }
+
+    // 视锥剔除：用相机可见区域查询空间索引，只为相交的节点生成渲染命令
+    // 未登记在空间索引中或关闭了剔除的节点总是参与渲染
+    void setFrustumCullingEnabled(bool enabled) { frustumCulling_ = enabled; }
+    bool isFrustumCullingEnabled() const { return frustumCulling_; }
+
+    // 当前收集过程的剔除标记，0 表示本次未进行剔除
+    uint32_t getCullStamp() const { return activeCullStamp_; }
+
+    // 并行收集：顶层子树分块交给线程池，各线程写入独立队列后按顺序合并
+    // 开启后节点的 generateRenderCommand 会在工作线程中执行
+    void setParallelCollectionEnabled(bool enabled) { parallelCollection_ = enabled; }
+    bool isParallelCollectionEnabled() const { return parallelCollection_; }
 
     // ------------------------------------------------------------------------
     // 空间索引系统
@@ -98,6 +117,20 @@ private:
     Ptr<Camera> defaultCamera_;
     
     bool paused_ = false;
+
+    // 渲染队列（跨帧复用）
+    RenderQueue renderQueue_;
+    std::vector<RenderQueue> chunkQueues_;
+    bool parallelCollection_ = false;
+
+    // 视锥剔除
+    bool frustumCulling_ = false;
+    uint32_t cullStamp_ = 0;
+    uint32_t activeCullStamp_ = 0;
+
+    void beginCulling();
+
+    void collectRenderCommandsParallel(RenderQueue& queue);
     
     // 空间索引系统
     SpatialManager spatialManager_;
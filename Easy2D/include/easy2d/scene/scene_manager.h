@@ -11,7 +11,7 @@
 namespace easy2d {
 
 // 前向声明
-struct RenderCommand;
+class RenderQueue;
 class Transition;
 
 // ============================================================================
@@ -89,7 +89,7 @@ public:
     // ------------------------------------------------------------------------
     void update(float dt);
     void render(RenderBackend& renderer);
-    void collectRenderCommands(std::vector<RenderCommand>& commands);
+    void collectRenderCommands(RenderQueue& queue);
 
     // ------------------------------------------------------------------------
     // 过渡控制
@@ -97,6 +97,12 @@ public:
     bool isTransitioning() const { return isTransitioning_; }
     void setTransitionCallback(TransitionCallback callback) { transitionCallback_ = callback; }
 
+    // 内置过渡是否使用场景快照（见 Transition::setSnapshotEnabled / setIncomingLive）
+    void setTransitionSnapshots(bool enabled, bool incomingLive = false) {
+        transitionSnapshots_ = enabled;
+        transitionIncomingLive_ = incomingLive;
+    }
+
     // ------------------------------------------------------------------------
     // 清理
     // ------------------------------------------------------------------------
@@ -121,6 +127,8 @@ private:
     void dispatchPointerEvents(Scene& scene);
 
     std::stack<Ptr<Scene>> sceneStack_;
+    bool transitionSnapshots_ = true;
+    bool transitionIncomingLive_ = false;
     std::unordered_map<std::string, Ptr<Scene>> namedScenes_;
     
     // Transition state
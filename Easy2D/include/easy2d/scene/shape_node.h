@@ -93,7 +93,7 @@ public:
 
 protected:
     void onDraw(RenderBackend& renderer) override;
-    void generateRenderCommand(std::vector<RenderCommand>& commands, int zOrder) override;
+    void generateRenderCommand(RenderQueue& queue, int zOrder) override;
 
 private:
     ShapeType shapeType_ = ShapeType::Rect;
@@ -39,9 +39,12 @@ public:
 
     Rect getBoundingBox() const override;
 
+    // 计算绘制用的目标矩形和源矩形（已处理锚点、缩放和翻转），无有效纹理时返回 false
+    bool getDrawRects(Rect& destRect, Rect& srcRect) const;
+
 protected:
     void onDraw(RenderBackend& renderer) override;
-    void generateRenderCommand(std::vector<RenderCommand>& commands, int zOrder) override;
+    void generateRenderCommand(RenderQueue& queue, int zOrder) override;
 
 private:
     Ptr<Texture> texture_;
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <easy2d/scene/node.h>
+#include <easy2d/graphics/static_sprite_buffer.h>
+#include <vector>
+
+namespace easy2d {
+
+class Texture;
+
+// ============================================================================
+// 静态精灵层 - 将直接子节点中的精灵一次性烘焙到 GPU 缓冲区，之后每帧只按纹理
+// 发出绘制调用，不再逐个精灵生成顶点。适用于地图背景等几乎不变的大量精灵。
+//
+// - 添加/移除子节点会自动触发重新烘焙；修改子精灵的属性（位置、纹理、颜色、
+//   可见性等）后需调用 markDirty()
+// - 精灵按纹理分组绘制，不同纹理的精灵之间不保证相互遮挡的顺序，
+//   相互重叠的内容应放在不同的层中
+// - 非精灵子节点以及精灵自身的子节点照常渲染
+// ============================================================================
+class StaticSpriteLayer : public Node {
+public:
+    StaticSpriteLayer();
+    ~StaticSpriteLayer() override = default;
+
+    static Ptr<StaticSpriteLayer> create();
+
+    // 标记需要重新烘焙（下一次绘制时生效）
+    void markDirty() { bakeDirty_ = true; }
+    bool isDirty() const { return bakeDirty_; }
+
+    // 已烘焙的精灵数量
+    size_t getBakedSpriteCount() const;
+
+    // 已烘焙精灵的包围盒
+    Rect getBoundingBox() const override;
+
+    void onRender(RenderBackend& renderer) override;
+    void collectRenderCommands(RenderQueue& queue, int parentZOrder = 0) override;
+
+protected:
+    void onDraw(RenderBackend& renderer) override;
+    void onChildrenChanged() override;
+
+private:
+    // 烘焙后仍需遍历的子节点
+    struct DynamicChild {
+        Node* node;
+        bool baked;         // 自身已烘焙，只需遍历其子节点
+    };
+
+    Ptr<StaticSpriteBuffer> buffer_;
+    std::vector<StaticSprite> sprites_;
+    std::vector<Ptr<Texture>> textures_;    // 保持已烘焙纹理的生命周期
+    std::vector<DynamicChild> dynamicChildren_;
+    Rect bounds_;
+    bool bakeDirty_ = true;
+    bool childrenDirty_ = true;
+
+    void refreshChildren();
+    void bake(RenderBackend& renderer);
+};
+
+} // namespace easy2d
@@ -4,6 +4,7 @@
 #include <easy2d/core/color.h>
 #include <easy2d/core/string.h>
 #include <easy2d/graphics/font.h>
+#include <easy2d/graphics/glyph_run.h>
 
 namespace easy2d {
 
@@ -66,7 +67,7 @@ public:
 
 protected:
     void onDraw(RenderBackend& renderer) override;
-    void generateRenderCommand(std::vector<RenderCommand>& commands, int zOrder) override;
+    void generateRenderCommand(RenderQueue& queue, int zOrder) override;
 
 private:
     String text_;
@@ -75,9 +76,12 @@ private:
     int fontSize_ = 16;
     Alignment alignment_ = Alignment::Left;
     
+    // 排版缓存：文字或字体变化、图集移动字形后重建；对齐只影响绘制位置
+    mutable GlyphRun run_;
     mutable Vec2 cachedSize_ = Vec2::Zero();
     mutable bool sizeDirty_ = true;
     
+    bool isCacheDirty() const { return sizeDirty_ || !run_.isValid(*font_); }
     void updateCache() const;
 };
 
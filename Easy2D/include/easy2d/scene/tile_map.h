@@ -0,0 +1,93 @@
+#pragma once
+
+#include <easy2d/scene/node.h>
+#include <easy2d/graphics/static_sprite_buffer.h>
+#include <vector>
+
+namespace easy2d {
+
+class Texture;
+
+// ============================================================================
+// 瓦片地图节点 - 瓦片 ID 紧凑存储在一维数组中，地图按固定大小分块，
+// 每块拥有独立的静态精灵缓冲区：
+// - 顶点以块左上角为原点烘焙，节点的世界变换（含父节点、缩放、旋转）在绘制时
+//   作为模型矩阵应用，移动地图不会重建任何块
+// - 只有被修改过的块会重建顶点，且重建延迟到该块第一次可见时
+// - 绘制时只提交与相机可见区域相交的块
+//
+// 瓦片 ID 0 表示空，ID n 对应图块集中第 n 个图块（从左上角开始按行排列，从 1 计数）；
+// 超出图块集范围的 ID 不绘制
+// ============================================================================
+class TileMap : public Node {
+public:
+    using TileId = uint16_t;
+    static constexpr TileId EMPTY_TILE = 0;
+    static constexpr int CHUNK_SIZE = 32;   // 每块边长（瓦片数）
+
+    TileMap(Ptr<Texture> tileset, const Size& tileSize, int width, int height);
+    ~TileMap() override = default;
+
+    static Ptr<TileMap> create(Ptr<Texture> tileset, const Size& tileSize, int width, int height);
+
+    // ------------------------------------------------------------------------
+    // 瓦片
+    // ------------------------------------------------------------------------
+    void setTile(int x, int y, TileId id);
+    TileId getTile(int x, int y) const;
+    void fill(TileId id);
+
+    // 批量设置（tiles 按行存放，长度为 width * height）
+    void setTiles(const std::vector<TileId>& tiles);
+
+    int getMapWidth() const { return width_; }
+    int getMapHeight() const { return height_; }
+    Size getTileSize() const { return tileSize_; }
+
+    // 世界坐标与瓦片坐标互相转换
+    bool worldToTile(const Vec2& pos, int& x, int& y) const;
+    Vec2 tileToWorld(int x, int y) const;
+
+    // ------------------------------------------------------------------------
+    // 图块集
+    // ------------------------------------------------------------------------
+    void setTileset(Ptr<Texture> tileset);
+    Ptr<Texture> getTileset() const { return tileset_; }
+
+    // ------------------------------------------------------------------------
+    // 统计
+    // ------------------------------------------------------------------------
+    size_t getChunkCount() const { return chunks_.size(); }
+    size_t getVisibleChunkCount() const { return visibleChunks_; }
+
+    Rect getBoundingBox() const override;
+
+protected:
+    void onDraw(RenderBackend& renderer) override;
+
+private:
+    struct Chunk {
+        Ptr<StaticSpriteBuffer> buffer;
+        bool dirty = true;
+    };
+
+    Ptr<Texture> tileset_;
+    Size tileSize_;
+    int width_;
+    int height_;
+    int columns_;               // 图块集每行的图块数
+    int tileCount_;             // 图块集中的图块总数
+    std::vector<TileId> tiles_;
+
+    int chunkColumns_;
+    int chunkRows_;
+    std::vector<Chunk> chunks_;
+    std::vector<StaticSprite> scratch_;
+    size_t visibleChunks_ = 0;
+
+    void updateTilesetLayout();
+    void markAllChunksDirty();
+    void rebuildChunk(RenderBackend& renderer, int chunkX, int chunkY, Chunk& chunk);
+};
+
+} // namespace easy2d
@@ -7,6 +7,8 @@
 
 namespace easy2d {
 
+class RenderTarget;
+
 // ============================================================================
 // 过渡方向
 // ============================================================================
@@ -53,6 +55,15 @@ public:
     Ptr<Scene> getOutgoingScene() const { return outgoingScene_; }
     Ptr<Scene> getIncomingScene() const { return incomingScene_; }
 
+    // 快照模式（默认开启）：第一帧把两个场景各渲染一次到离屏纹理，
+    // 之后每帧只绘制纹理四边形；渲染目标创建失败时退回实时渲染
+    void setSnapshotEnabled(bool enabled) { snapshotEnabled_ = enabled; }
+    bool isSnapshotEnabled() const { return snapshotEnabled_; }
+
+    // 快照模式下进入的场景仍每帧重新渲染到纹理（场景自身有动画时使用）
+    void setIncomingLive(bool live) { incomingLive_ = live; }
+    bool isIncomingLive() const { return incomingLive_; }
+
 protected:
     // 子类实现具体的渲染效果
     virtual void onRenderTransition(RenderBackend& renderer, float progress) = 0;
@@ -60,6 +71,17 @@ protected:
     // 过渡完成时调用
     virtual void onFinish();
 
+    // 屏幕尺寸（取场景视口大小，未设置时为 800x600）
+    Size getScreenSize() const;
+
+    // 场景快照，未使用快照模式时为 nullptr
+    const RenderTarget* getOutgoingSnapshot() const { return outgoingSnapshot_.get(); }
+    const RenderTarget* getIncomingSnapshot() const { return incomingSnapshot_.get(); }
+
+    // 以 center 为中心、size 为大小绘制快照，rotation 为角度
+    void drawSnapshot(RenderBackend& renderer, const RenderTarget& snapshot, const Vec2& center,
+                      const Size& size, float alpha = 1.0f, float rotation = 0.0f);
+
     float duration_;
     float elapsed_;
     float progress_;
@@ -69,6 +91,17 @@ protected:
     Ptr<Scene> outgoingScene_;
     Ptr<Scene> incomingScene_;
     FinishCallback finishCallback_;
+
+    bool snapshotEnabled_;
+    bool incomingLive_;
+    Ptr<RenderTarget> outgoingSnapshot_;
+    Ptr<RenderTarget> incomingSnapshot_;
+
+private:
+    bool snapshotsTaken_;
+
+    void updateSnapshots(RenderBackend& renderer);
+    Ptr<RenderTarget> captureScene(RenderBackend& renderer, Scene& scene, Ptr<RenderTarget> target);
 };
 
 // ============================================================================
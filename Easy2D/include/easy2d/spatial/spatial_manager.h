@@ -45,6 +45,8 @@ public:
 
 private:
     void selectOptimalStrategy();
+    void rebuildIndex(const Rect& previousBounds);
+    void ensureContains(const Rect& bounds);
 
     SpatialStrategy currentStrategy_ = SpatialStrategy::Auto;
     SpatialStrategy activeStrategy_ = SpatialStrategy::QuadTree;
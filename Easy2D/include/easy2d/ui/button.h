@@ -2,6 +2,7 @@
 
 #include <easy2d/ui/widget.h>
 #include <easy2d/graphics/font.h>
+#include <easy2d/graphics/glyph_run.h>
 #include <easy2d/graphics/texture.h>
 #include <easy2d/platform/window.h>
 
@@ -63,20 +64,30 @@ public:
 
     void setOnClick(Function<void()> callback);
 
+    // 启用 Alpha 遮罩点击检测且图片带有遮罩时，只有不透明像素响应点击
+    bool hitTest(const Vec2& point) const override;
+
 protected:
     void onDraw(RenderBackend& renderer) override;
     void drawBackgroundImage(RenderBackend& renderer, const Rect& rect);
     void drawRoundedRect(RenderBackend& renderer, const Rect& rect, const Color& color, float radius);
     void fillRoundedRect(RenderBackend& renderer, const Rect& rect, const Color& color, float radius);
-    Vec2 calculateImageSize(const Vec2& buttonSize, const Vec2& imageSize);
+    Vec2 calculateImageSize(const Vec2& buttonSize, const Vec2& imageSize) const;
+
+    // 点击检测使用的图片及其绘制区域，没有图片时返回 false
+    virtual bool getHitTestImage(const Texture*& texture, Rect& imageRect) const;
 
     // 状态访问（供子类使用）
     bool isHovered() const { return hovered_; }
     bool isPressed() const { return pressed_; }
 
+    // 文字排版缓存，需要时按当前文字和字体重建；没有字体时返回空串
+    const GlyphRun& getTextRun() const;
+
 private:
     String text_;
     Ptr<FontAtlas> font_;
+    mutable GlyphRun textRun_;
     Vec2 padding_ = Vec2(10.0f, 6.0f);
 
     // 文字颜色
@@ -146,6 +157,7 @@ public:
 
 protected:
     void onDraw(RenderBackend& renderer) override;
+    bool getHitTestImage(const Texture*& texture, Rect& imageRect) const override;
 
 private:
     // 状态图片
@@ -153,8 +165,9 @@ private:
     Ptr<Texture> imgOffHover_, imgOnHover_;
     Ptr<Texture> imgOffPressed_, imgOnPressed_;
 
-    // 状态文字
+    // 状态文字及其排版缓存
     String textOff_, textOn_;
+    mutable GlyphRun textRunOff_, textRunOn_;
     bool useStateText_ = false;
 
     // 状态文字颜色
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <easy2d/core/types.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace easy2d {
+
+// ============================================================================
+// ThreadPool 类 - 固定数量工作线程的任务池
+// ============================================================================
+class ThreadPool {
+public:
+    using Task = Function<void()>;
+
+    /// 创建线程池，threadCount 为 0 时不创建工作线程（所有任务在调用线程执行）
+    explicit ThreadPool(size_t threadCount);
+    ~ThreadPool();
+
+    // 禁止拷贝
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// 提交异步任务
+    void submit(Task task);
+
+    /// 并行执行 task(0) ... task(count - 1)，调用线程同样参与执行，返回时全部完成
+    /// 在工作线程中调用时直接串行执行，避免嵌套等待造成死锁
+    void parallelFor(size_t count, const Function<void(size_t)>& task);
+
+    /// 工作线程数量
+    size_t getThreadCount() const { return workers_.size(); }
+
+    /// 当前线程是否为线程池的工作线程
+    static bool isWorkerThread();
+
+    /// 默认工作线程数（硬件线程数 - 1，至少为 0）
+    static size_t getDefaultThreadCount();
+
+private:
+    std::vector<std::thread> workers_;
+    std::deque<Task> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stopping_ = false;
+
+    void workerLoop();
+};
+
+} // namespace easy2d
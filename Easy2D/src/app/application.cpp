@@ -10,6 +10,7 @@
 #include <easy2d/graphics/camera.h>
 #include <easy2d/graphics/render_backend.h>
 #include <easy2d/utils/logger.h>
+#include <easy2d/utils/thread_pool.h>
 #include <GLFW/glfw3.h>
 #include <chrono>
 #include <thread>
@@ -64,10 +65,15 @@ bool Application::init(const AppConfig& config) {
         glfwTerminate();
         return false;
     }
+    renderer_->setSpriteRenderPath(config.spriteRenderPath);
 
     // 初始化其他子系统
+    size_t workerThreads = config.workerThreads < 0 ? ThreadPool::getDefaultThreadCount()
+                                                    : static_cast<size_t>(config.workerThreads);
+    threadPool_ = makeUnique<ThreadPool>(workerThreads);
     sceneManager_ = makeUnique<SceneManager>();
     resourceManager_ = makeUnique<ResourceManager>();
+    resourceManager_->setThreadPool(threadPool_.get());
     timerManager_ = makeUnique<TimerManager>();
     eventQueue_ = makeUnique<EventQueue>();
     eventDispatcher_ = makeUnique<EventDispatcher>();
@@ -120,6 +126,7 @@ void Application::shutdown() {
     eventQueue_.reset();
     eventDispatcher_.reset();
     camera_.reset();
+    threadPool_.reset();
 
     // 关闭音频
     AudioEngine::getInstance().shutdown();
@@ -203,6 +210,11 @@ void Application::mainLoop() {
         eventDispatcher_->processQueue(*eventQueue_);
     }
 
+    // 上传异步解码完成的纹理（暂停时也继续，避免恢复后集中上传）
+    if (resourceManager_) {
+        resourceManager_->processAsyncUploads(config_.textureUploadBudget);
+    }
+
     // 更新
     if (!paused_) {
         update();
@@ -283,6 +295,10 @@ Camera& Application::camera() {
     return *camera_;
 }
 
+ThreadPool& Application::threadPool() {
+    return *threadPool_;
+}
+
 void Application::enterScene(Ptr<Scene> scene) {
     enterScene(scene, nullptr);
 }
@@ -1,53 +1,150 @@
 #include <easy2d/graphics/alpha_mask.h>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define E2D_ALPHA_MASK_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define E2D_ALPHA_MASK_NEON 1
+#include <arm_neon.h>
+#endif
 
 namespace easy2d {
 
 AlphaMask::AlphaMask(int width, int height)
-    : width_(width)
-    , height_(height)
-    , data_(width * height, 255) {
+    : width_(std::max(width, 0))
+    , height_(std::max(height, 0))
+    , stride_((width_ + 7) / 8)
+    , tilesX_((width_ + TILE_SIZE - 1) / TILE_SIZE)
+    , tilesY_((height_ + TILE_SIZE - 1) / TILE_SIZE)
+    , data_(static_cast<size_t>(stride_) * height_, 0xFF)
+    , tiles_(static_cast<size_t>(tilesX_) * tilesY_, Coverage::Full) {
+    // 行尾补齐的位保持为 0
+    if (width_ % 8 != 0) {
+        uint8_t lastByte = static_cast<uint8_t>((1u << (width_ % 8)) - 1);
+        for (int y = 0; y < height_; ++y) {
+            data_[static_cast<size_t>(y) * stride_ + stride_ - 1] = lastByte;
+        }
+    }
 }
 
-AlphaMask AlphaMask::createFromPixels(const uint8_t* pixels, int width, int height, int channels) {
+AlphaMask AlphaMask::createFromPixels(const uint8_t* pixels, int width, int height, int channels,
+                                      uint8_t threshold) {
     AlphaMask mask(width, height);
     
-    if (!pixels || width <= 0 || height <= 0) {
+    // RGB 等没有 Alpha 通道的格式视为完全不透明
+    if (!pixels || width <= 0 || height <= 0 || (channels != 4 && channels != 1)) {
         return mask;
     }
     
-    // 根据通道数提取Alpha值
+    size_t rowBytes = static_cast<size_t>(width) * channels;
     for (int y = 0; y < height; ++y) {
-        for (int x = 0; x < width; ++x) {
-            int pixelIndex = (y * width + x) * channels;
-            uint8_t alpha = 255;
-            
-            if (channels == 4) {
-                // RGBA格式，Alpha在第四个通道
-                alpha = pixels[pixelIndex + 3];
-            } else if (channels == 1) {
-                // 灰度图，直接作为Alpha
-                alpha = pixels[pixelIndex];
-            } else if (channels == 3) {
-                // RGB格式，没有Alpha通道，视为不透明
-                alpha = 255;
-            }
-            
-            mask.data_[y * width + x] = alpha;
-        }
+        mask.buildRow(pixels + y * rowBytes, channels, threshold,
+                      mask.data_.data() + static_cast<size_t>(y) * mask.stride_);
     }
+    mask.buildTiles();
     
     return mask;
 }
 
-uint8_t AlphaMask::getAlpha(int x, int y) const {
+// ============================================================================
+// 生成一行位图 - RGBA 取第四个通道，灰度图直接作为 Alpha
+// 每次处理 16 个像素（写出 2 字节），剩余像素逐个处理
+// ============================================================================
+void AlphaMask::buildRow(const uint8_t* pixels, int channels, uint8_t threshold, uint8_t* bits) const {
+    std::memset(bits, 0, stride_);
+    int x = 0;
+
+#if defined(E2D_ALPHA_MASK_SSE2)
+    const __m128i thresholdVec = _mm_set1_epi8(static_cast<char>(threshold));
+    for (; x + 16 <= width_; x += 16) {
+        __m128i alpha;
+        if (channels == 4) {
+            const __m128i* src = reinterpret_cast<const __m128i*>(pixels + x * 4);
+            __m128i a0 = _mm_srli_epi32(_mm_loadu_si128(src + 0), 24);
+            __m128i a1 = _mm_srli_epi32(_mm_loadu_si128(src + 1), 24);
+            __m128i a2 = _mm_srli_epi32(_mm_loadu_si128(src + 2), 24);
+            __m128i a3 = _mm_srli_epi32(_mm_loadu_si128(src + 3), 24);
+            alpha = _mm_packus_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3));
+        } else {
+            alpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + x));
+        }
+        // alpha >= threshold  <=>  max(alpha, threshold) == alpha（无符号比较）
+        __m128i opaque = _mm_cmpeq_epi8(_mm_max_epu8(alpha, thresholdVec), alpha);
+        int mask = _mm_movemask_epi8(opaque);
+        bits[x / 8] = static_cast<uint8_t>(mask & 0xFF);
+        bits[x / 8 + 1] = static_cast<uint8_t>(mask >> 8);
+    }
+#elif defined(E2D_ALPHA_MASK_NEON)
+    static const uint8_t bitWeights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t weights = vld1q_u8(bitWeights);
+    const uint8x16_t thresholdVec = vdupq_n_u8(threshold);
+    for (; x + 16 <= width_; x += 16) {
+        uint8x16_t alpha = channels == 4 ? vld4q_u8(pixels + x * 4).val[3] : vld1q_u8(pixels + x);
+        uint8x16_t opaque = vandq_u8(vcgeq_u8(alpha, thresholdVec), weights);
+        // 两次成对相加把每 8 个权重位汇总成一个字节
+        uint8x8_t sum = vpadd_u8(vget_low_u8(opaque), vget_high_u8(opaque));
+        sum = vpadd_u8(sum, sum);
+        sum = vpadd_u8(sum, sum);
+        bits[x / 8] = vget_lane_u8(sum, 0);
+        bits[x / 8 + 1] = vget_lane_u8(sum, 1);
+    }
+#endif
+
+    int alphaOffset = channels == 4 ? 3 : 0;
+    for (; x < width_; ++x) {
+        if (pixels[x * channels + alphaOffset] >= threshold) {
+            bits[x >> 3] |= static_cast<uint8_t>(1u << (x & 7));
+        }
+    }
+}
+
+// ============================================================================
+// 生成块覆盖信息 - 块宽 8 像素，正好对应每行中的一个字节
+// ============================================================================
+void AlphaMask::buildTiles() {
+    uint8_t lastByteMask = width_ % 8 != 0 ? static_cast<uint8_t>((1u << (width_ % 8)) - 1) : 0xFF;
+
+    for (int ty = 0; ty < tilesY_; ++ty) {
+        int y0 = ty * TILE_SIZE;
+        int y1 = std::min(y0 + TILE_SIZE, height_);
+        for (int tx = 0; tx < tilesX_; ++tx) {
+            uint8_t full = tx == stride_ - 1 ? lastByteMask : 0xFF;
+            bool anySet = false;
+            bool allSet = true;
+            for (int y = y0; y < y1; ++y) {
+                uint8_t bits = data_[static_cast<size_t>(y) * stride_ + tx];
+                anySet |= bits != 0;
+                allSet &= bits == full;
+            }
+            tiles_[static_cast<size_t>(ty) * tilesX_ + tx] =
+                allSet ? Coverage::Full : (anySet ? Coverage::Mixed : Coverage::Empty);
+        }
+    }
+}
+
+AlphaMask::Coverage AlphaMask::getTileCoverage(int x, int y) const {
     if (!isValid(x, y)) {
-        return 0;
+        return Coverage::Empty;
     }
-    return data_[y * width_ + x];
+    return tiles_[static_cast<size_t>(y / TILE_SIZE) * tilesX_ + x / TILE_SIZE];
+}
+
+uint8_t AlphaMask::getAlpha(int x, int y) const {
+    return isOpaque(x, y) ? 255 : 0;
 }
 
-bool AlphaMask::isOpaque(int x, int y, uint8_t threshold) const {
-    return getAlpha(x, y) >= threshold;
+bool AlphaMask::isOpaque(int x, int y) const {
+    switch (getTileCoverage(x, y)) {
+        case Coverage::Empty:
+            return false;
+        case Coverage::Full:
+            return true;
+        case Coverage::Mixed:
+            break;
+    }
+    return (data_[static_cast<size_t>(y) * stride_ + (x >> 3)] >> (x & 7)) & 1u;
 }
 
 bool AlphaMask::isValid(int x, int y) const {
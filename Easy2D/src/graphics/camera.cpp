@@ -1,5 +1,6 @@
 #include <easy2d/graphics/camera.h>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/matrix.hpp>
 #include <algorithm>
 
 namespace easy2d {
@@ -58,6 +59,29 @@ Rect Camera::getViewport() const {
     return Rect(left_, top_, right_ - left_, bottom_ - top_);
 }
 
+Rect Camera::getWorldBounds() const {
+    // 将 NDC 的四个角反投影到世界坐标，取包围盒
+    glm::mat4 inverse = glm::inverse(getViewProjectionMatrix());
+    const float corners[4][2] = { {-1.0f, -1.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, {-1.0f, 1.0f} };
+
+    float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+    for (int i = 0; i < 4; ++i) {
+        glm::vec4 world = inverse * glm::vec4(corners[i][0], corners[i][1], 0.0f, 1.0f);
+        float x = world.x / world.w;
+        float y = world.y / world.w;
+        if (i == 0) {
+            minX = maxX = x;
+            minY = maxY = y;
+        } else {
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+        }
+    }
+    return Rect(minX, minY, maxX - minX, maxY - minY);
+}
+
 glm::mat4 Camera::getViewMatrix() const {
     if (viewDirty_) {
         viewMatrix_ = glm::mat4(1.0f);
@@ -0,0 +1,179 @@
+#include <easy2d/graphics/glyph_disk_cache.h>
+#include <easy2d/utils/logger.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+namespace easy2d {
+
+namespace {
+
+constexpr char MAGIC[4] = { 'E', '2', 'D', 'G' };
+// 光栅化参数（如 SDF 边距）变化时递增，旧文件随之作废
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t FLAG_SDF = 1u << 0;
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint64_t fontHash;
+    int32_t fontSize;
+    uint32_t flags;
+};
+
+struct Record {
+    uint32_t codepoint;
+    uint16_t width;
+    uint16_t height;
+    int16_t xoff;
+    int16_t yoff;
+};
+
+static_assert(sizeof(Header) == 24, "glyph cache header must stay tightly packed");
+static_assert(sizeof(Record) == 12, "glyph cache record must stay tightly packed");
+
+// FNV-1a 64 位内容哈希，字体文件改动后自动使用新的缓存文件
+uint64_t hashBytes(const uint8_t* data, size_t size) {
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < size; ++i) {
+        h ^= data[i];
+        h *= 0x100000001B3ull;
+    }
+    return h;
+}
+
+} // namespace
+
+GlyphDiskCache::~GlyphDiskCache() {
+    if (file_.is_open()) {
+        file_.close();
+    }
+}
+
+bool GlyphDiskCache::open(const std::string& directory, const uint8_t* fontData, size_t fontDataSize,
+                          int fontSize, bool sdf) {
+    if (directory.empty() || !fontData || fontDataSize == 0) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.fontHash = hashBytes(fontData, fontDataSize);
+    header.fontSize = fontSize;
+    header.flags = sdf ? FLAG_SDF : 0;
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%016llx_%d%s.glyphs",
+                  static_cast<unsigned long long>(header.fontHash), fontSize, sdf ? "_sdf" : "");
+    path_ = (std::filesystem::path(directory) / name).string();
+
+    // 读入已有内容
+    data_.clear();
+    index_.clear();
+    {
+        std::ifstream in(path_, std::ios::binary | std::ios::ate);
+        if (in.is_open()) {
+            std::streamsize size = in.tellg();
+            in.seekg(0, std::ios::beg);
+            data_.resize(static_cast<size_t>(std::max<std::streamsize>(size, 0)));
+            if (!in.read(reinterpret_cast<char*>(data_.data()), size)) {
+                data_.clear();
+            }
+        }
+    }
+
+    bool valid = data_.size() >= sizeof(Header) && std::memcmp(data_.data(), &header, sizeof(Header)) == 0;
+    size_t validSize = valid ? parse() : 0;
+
+    if (valid && validSize == data_.size()) {
+        file_.open(path_, std::ios::binary | std::ios::app);
+    } else {
+        // 新文件、头部不匹配或末尾记录不完整（上次写入被中断）：重写有效部分
+        if (!valid) {
+            index_.clear();
+            data_.assign(reinterpret_cast<const uint8_t*>(&header),
+                         reinterpret_cast<const uint8_t*>(&header) + sizeof(Header));
+        } else {
+            data_.resize(validSize);
+        }
+        file_.open(path_, std::ios::binary | std::ios::trunc);
+        if (file_.is_open()) {
+            file_.write(reinterpret_cast<const char*>(data_.data()), static_cast<std::streamsize>(data_.size()));
+        }
+    }
+
+    if (!file_.is_open()) {
+        E2D_LOG_WARN("GlyphDiskCache: cannot open {}", path_);
+        data_.clear();
+        index_.clear();
+        return false;
+    }
+
+    E2D_LOG_DEBUG("GlyphDiskCache: {} ({} glyphs)", path_, index_.size());
+    return true;
+}
+
+size_t GlyphDiskCache::parse() {
+    size_t offset = sizeof(Header);
+    while (offset + sizeof(Record) <= data_.size()) {
+        Record record;
+        std::memcpy(&record, data_.data() + offset, sizeof(Record));
+        size_t pixelBytes = static_cast<size_t>(record.width) * record.height;
+        if (offset + sizeof(Record) + pixelBytes > data_.size()) {
+            break;
+        }
+        index_[static_cast<char32_t>(record.codepoint)] = offset;
+        offset += sizeof(Record) + pixelBytes;
+    }
+    return offset;
+}
+
+bool GlyphDiskCache::find(char32_t codepoint, Entry& entry) const {
+    auto it = index_.find(codepoint);
+    if (it == index_.end()) {
+        return false;
+    }
+
+    Record record;
+    std::memcpy(&record, data_.data() + it->second, sizeof(Record));
+    entry.width = record.width;
+    entry.height = record.height;
+    entry.xoff = record.xoff;
+    entry.yoff = record.yoff;
+    entry.pixels = data_.data() + it->second + sizeof(Record);
+    return true;
+}
+
+void GlyphDiskCache::append(char32_t codepoint, int width, int height, int xoff, int yoff,
+                            const uint8_t* pixels) {
+    if (!file_.is_open() || index_.count(codepoint) != 0 ||
+        width < 0 || height < 0 || width > 0xFFFF || height > 0xFFFF) {
+        return;
+    }
+
+    Record record;
+    record.codepoint = static_cast<uint32_t>(codepoint);
+    record.width = static_cast<uint16_t>(width);
+    record.height = static_cast<uint16_t>(height);
+    record.xoff = static_cast<int16_t>(xoff);
+    record.yoff = static_cast<int16_t>(yoff);
+    size_t pixelBytes = static_cast<size_t>(width) * height;
+
+    size_t offset = data_.size();
+    data_.resize(offset + sizeof(Record) + pixelBytes);
+    std::memcpy(data_.data() + offset, &record, sizeof(Record));
+    if (pixelBytes > 0) {
+        std::memcpy(data_.data() + offset + sizeof(Record), pixels, pixelBytes);
+    }
+    index_[codepoint] = offset;
+
+    file_.write(reinterpret_cast<const char*>(data_.data() + offset),
+                static_cast<std::streamsize>(sizeof(Record) + pixelBytes));
+}
+
+} // namespace easy2d
@@ -0,0 +1,72 @@
+#include <easy2d/graphics/glyph_run.h>
+#include <easy2d/graphics/font.h>
+#include <algorithm>
+
+namespace easy2d {
+
+// ============================================================================
+// 排版 - 与 GLRenderer::drawText 的逐字绘制结果一致
+// ============================================================================
+void GlyphRun::build(const FontAtlas& font, const String& text) {
+    quads_.clear();
+    font_ = &font;
+    generation_ = font.getGeneration();
+    sdf_ = font.isSDF();
+
+    float lineHeight = font.getLineHeight();
+    float cursorX = 0.0f;
+    float cursorY = 0.0f;
+    // 基线在行顶下方 ascent 处
+    float baselineY = font.getAscent();
+    float width = 0.0f;
+    float height = font.getAscent() - font.getDescent();
+
+    for (char32_t codepoint : text.toUtf32()) {
+        if (codepoint == '\n') {
+            width = std::max(width, cursorX);
+            cursorX = 0.0f;
+            cursorY += lineHeight;
+            baselineY = cursorY + font.getAscent();
+            height += lineHeight;
+            continue;
+        }
+
+        const Glyph* glyph = font.getGlyph(codepoint);
+        if (!glyph) {
+            continue;
+        }
+
+        float penX = cursorX;
+        cursorX += glyph->advance;
+        if (glyph->width <= 0.0f || glyph->height <= 0.0f) {
+            continue;
+        }
+
+        Texture* page = font.getPageTexture(glyph->page);
+        if (!page) {
+            continue;
+        }
+
+        Quad quad;
+        quad.rect = Rect(penX + glyph->bearingX, baselineY + glyph->bearingY, glyph->width, glyph->height);
+        quad.u0 = glyph->u0;
+        quad.v0 = glyph->v0;
+        quad.u1 = glyph->u1;
+        quad.v1 = glyph->v1;
+        quad.texture = page;
+        quads_.push_back(quad);
+    }
+
+    size_ = Vec2(std::max(width, cursorX), height);
+
+    // 排版过程中图集可能压缩过页，之前取得的字形坐标已失效，下次使用时重建
+    if (font.getGeneration() != generation_) {
+        invalidate();
+    }
+}
+
+bool GlyphRun::isValid(const FontAtlas& font) const {
+    return font_ == &font && generation_ == font.getGeneration();
+}
+
+} // namespace easy2d
@@ -1,4 +1,6 @@
 #include <easy2d/graphics/opengl/gl_font_atlas.h>
+#include <easy2d/graphics/opengl/gl_texture_uploader.h>
+#include <easy2d/utils/thread_pool.h>
 #define STB_TRUETYPE_IMPLEMENTATION
 #include <stb/stb_truetype.h>
 #define STB_RECT_PACK_IMPLEMENTATION
@@ -6,16 +8,86 @@
 #include <easy2d/utils/logger.h>
 #include <fstream>
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 
 namespace easy2d {
 
+namespace {
+
+// SDF 字形参数
+constexpr int SDF_PADDING = 8;
+constexpr unsigned char ONEDGE_VALUE = 128;
+constexpr float PIXEL_DIST_SCALE = 64.0f;
+
+std::atomic<uint64_t> g_frame{ 1 };
+
+// 有脏区域等待上传的图集（仅主线程访问）
+std::vector<const GLFontAtlas*> g_pendingAtlases;
+
+// 有预光栅化结果等待转存到磁盘缓存的图集（仅主线程访问）
+std::vector<GLFontAtlas*> g_drainingAtlases;
+
+FontAtlasConfig& defaultConfig() {
+    static FontAtlasConfig config;
+    return config;
+}
+
+} // namespace
+
+void GLFontAtlas::setDefaultConfig(const FontAtlasConfig& config) {
+    defaultConfig() = config;
+}
+
+const FontAtlasConfig& GLFontAtlas::getDefaultConfig() {
+    return defaultConfig();
+}
+
+void GLFontAtlas::advanceFrame() {
+    g_frame.fetch_add(1, std::memory_order_relaxed);
+
+    // 启用磁盘缓存时结果不必留在内存中等待使用，全部完成后注销
+    g_drainingAtlases.erase(std::remove_if(g_drainingAtlases.begin(), g_drainingAtlases.end(),
+                                           [](GLFontAtlas* atlas) {
+                                               if (atlas->drainPrewarmed()) {
+                                                   return false;
+                                               }
+                                               atlas->pendingDrain_ = false;
+                                               return true;
+                                           }),
+                            g_drainingAtlases.end());
+}
+
+void GLFontAtlas::flushUploads() {
+    if (g_pendingAtlases.empty()) {
+        return;
+    }
+    for (const GLFontAtlas* atlas : g_pendingAtlases) {
+        atlas->uploadDirtyPages();
+    }
+    g_pendingAtlases.clear();
+}
+
+
 // ============================================================================
 // 构造函数 - 初始化字体图集
 // ============================================================================
 GLFontAtlas::GLFontAtlas(const std::string& filepath, int fontSize, bool useSDF)
+    : GLFontAtlas(filepath, fontSize, useSDF, getDefaultConfig()) {
+}
+
+GLFontAtlas::GLFontAtlas(const std::string& filepath, int fontSize, bool useSDF, const FontAtlasConfig& config)
     : fontSize_(fontSize)
     , useSDF_(useSDF)
-    , currentY_(0)
+    , config_(config)
+    , evictedGlyphs_(0)
+    , warnedFull_(false)
+    , generation_(0)
+    , pendingUpload_(false)
+    , pendingDrain_(false)
+    , retiredFrame_(0)
+    , fontData_(makePtr<std::vector<unsigned char>>())
+    , prewarmQueue_(makePtr<PrewarmQueue>())
     , scale_(0.0f)
     , ascent_(0.0f)
     , descent_(0.0f)
@@ -30,14 +102,14 @@ GLFontAtlas::GLFontAtlas(const std::string& filepath, int fontSize, bool useSDF)
 
     std::streamsize size = file.tellg();
     file.seekg(0, std::ios::beg);
-    fontData_.resize(size);
-    if (!file.read(reinterpret_cast<char*>(fontData_.data()), size)) {
+    fontData_->resize(size);
+    if (!file.read(reinterpret_cast<char*>(fontData_->data()), size)) {
         E2D_LOG_ERROR("Failed to read font file: {}", filepath);
         return;
     }
 
     // 初始化 stb_truetype
-    if (!stbtt_InitFont(&fontInfo_, fontData_.data(), stbtt_GetFontOffsetForIndex(fontData_.data(), 0))) {
+    if (!stbtt_InitFont(&fontInfo_, fontData_->data(), stbtt_GetFontOffsetForIndex(fontData_->data(), 0))) {
         E2D_LOG_ERROR("Failed to init font: {}", filepath);
         return;
     }
@@ -50,24 +122,133 @@ GLFontAtlas::GLFontAtlas(const std::string& filepath, int fontSize, bool useSDF)
     descent_ = static_cast<float>(descent) * scale_;
     lineGap_ = static_cast<float>(lineGap) * scale_;
 
-    createAtlas();
+    config_.pageSize = std::max(config_.pageSize, 64);
+    config_.maxPages = std::max(config_.maxPages, 1);
+    config_.evictAfterFrames = std::max<uint32_t>(config_.evictAfterFrames, 1);
+
+    if (!config_.diskCacheDir.empty()) {
+        diskCache_ = std::make_unique<GlyphDiskCache>();
+        if (!diskCache_->open(config_.diskCacheDir, fontData_->data(), fontData_->size(), fontSize_, useSDF_)) {
+            diskCache_.reset();
+        }
+    }
+    createPage();
 }
 
 // ============================================================================
 // 析构函数
 // ============================================================================
-GLFontAtlas::~GLFontAtlas() = default;
+GLFontAtlas::~GLFontAtlas() {
+    prewarmQueue_->cancelled.store(true, std::memory_order_relaxed);
+    if (pendingUpload_) {
+        g_pendingAtlases.erase(std::remove(g_pendingAtlases.begin(), g_pendingAtlases.end(), this),
+                               g_pendingAtlases.end());
+    }
+    if (pendingDrain_) {
+        g_drainingAtlases.erase(std::remove(g_drainingAtlases.begin(), g_drainingAtlases.end(), this),
+                                g_drainingAtlases.end());
+    }
+}
+
+Texture* GLFontAtlas::getPageTexture(uint32_t page) const {
+    return page < pages_.size() ? pages_[page]->texture.get() : nullptr;
+}
 
 // ============================================================================
 // 获取字形 - 如果字形不存在则缓存它
 // ============================================================================
 const Glyph* GLFontAtlas::getGlyph(char32_t codepoint) const {
-    auto it = glyphs_.find(codepoint);
-    if (it == glyphs_.end()) {
-        cacheGlyph(codepoint);
-        it = glyphs_.find(codepoint);
+    uint64_t frame = g_frame.load(std::memory_order_relaxed);
+    if (GlyphSlot* slot = glyphs_.find(codepoint)) {
+        if (slot->placed) {
+            slot->lastUsed = frame;
+            return &slot->glyph;
+        }
+        // 负缓存：放置失败的字形在一段时间内不再重试
+        if (frame - slot->lastUsed < config_.evictAfterFrames) {
+            return &slot->glyph;
+        }
+    }
+
+    return &cacheGlyph(codepoint).glyph;
+}
+
+// ============================================================================
+// 字形表
+// ============================================================================
+GLFontAtlas::GlyphSlot* GLFontAtlas::GlyphTable::find(char32_t codepoint) {
+    GlyphSlot* slot = nullptr;
+    if (codepoint < 128) {
+        slot = &ascii_[codepoint];
+    } else if (codepoint < 0x10000) {
+        const auto& block = blocks_[codepoint / BLOCK_SIZE];
+        if (!block) {
+            return nullptr;
+        }
+        slot = &(*block)[codepoint % BLOCK_SIZE];
+    } else {
+        auto it = overflow_.find(codepoint);
+        return it != overflow_.end() ? &it->second : nullptr;
+    }
+    return slot->cached ? slot : nullptr;
+}
+
+GLFontAtlas::GlyphSlot& GLFontAtlas::GlyphTable::insert(char32_t codepoint) {
+    GlyphSlot* slot = nullptr;
+    if (codepoint < 128) {
+        slot = &ascii_[codepoint];
+    } else if (codepoint < 0x10000) {
+        auto& block = blocks_[codepoint / BLOCK_SIZE];
+        if (!block) {
+            block = std::make_unique<Block>();
+        }
+        slot = &(*block)[codepoint % BLOCK_SIZE];
+    } else {
+        slot = &overflow_[codepoint];
+    }
+
+    if (!slot->cached) {
+        count_++;
+    }
+    *slot = GlyphSlot{};
+    slot->cached = true;
+    return *slot;
+}
+
+void GLFontAtlas::GlyphTable::erase(char32_t codepoint) {
+    if (codepoint >= 0x10000) {
+        count_ -= overflow_.erase(codepoint);
+        return;
+    }
+    if (GlyphSlot* slot = find(codepoint)) {
+        *slot = GlyphSlot{};
+        count_--;
+    }
+}
+
+template <typename Fn>
+void GLFontAtlas::GlyphTable::forEach(Fn&& fn) {
+    for (char32_t c = 0; c < 128; ++c) {
+        if (ascii_[c].cached) {
+            fn(c, ascii_[c]);
+        }
+    }
+    for (size_t b = 0; b < blocks_.size(); ++b) {
+        if (!blocks_[b]) {
+            continue;
+        }
+        for (size_t i = 0; i < BLOCK_SIZE; ++i) {
+            GlyphSlot& slot = (*blocks_[b])[i];
+            if (slot.cached) {
+                fn(static_cast<char32_t>(b * BLOCK_SIZE + i), slot);
+            }
+        }
+    }
+    for (auto it = overflow_.begin(); it != overflow_.end();) {
+        // 先前移迭代器，fn 可能擦除当前字形
+        auto current = it++;
+        fn(current->first, current->second);
     }
-    return (it != glyphs_.end()) ? &it->second : nullptr;
 }
 
 // ============================================================================
@@ -97,36 +278,324 @@ Vec2 GLFontAtlas::measureText(const String& text) {
 }
 
 // ============================================================================
-// 创建图集纹理 - 初始化空白纹理和矩形打包上下文
+// 图集页
 // ============================================================================
-void GLFontAtlas::createAtlas() {
-    int channels = useSDF_ ? 1 : 4;
-    std::vector<uint8_t> emptyData(ATLAS_WIDTH * ATLAS_HEIGHT * channels, 0);
-    texture_ = std::make_unique<GLTexture>(ATLAS_WIDTH, ATLAS_HEIGHT, emptyData.data(), channels);
-    texture_->setFilter(true);
-    
-    // 初始化矩形打包上下文
-    packNodes_.resize(ATLAS_WIDTH);
-    stbrp_init_target(&packContext_, ATLAS_WIDTH, ATLAS_HEIGHT, packNodes_.data(), ATLAS_WIDTH);
+GLFontAtlas::Page& GLFontAtlas::createPage() const {
+    int pageSize = config_.pageSize;
+
+    auto page = std::make_unique<Page>();
+    page->pixels.assign(static_cast<size_t>(pageSize) * pageSize, 0);
+    page->texture = createPageTexture(*page);
+    resetPacker(*page);
+
+    pages_.push_back(std::move(page));
+    E2D_LOG_DEBUG("GLFontAtlas: created page {} ({}x{}, size {})", pages_.size(), pageSize, pageSize, fontSize_);
+    return *pages_.back();
+}
+
+// 以内存副本为初始内容创建页纹理
+std::unique_ptr<GLTexture> GLFontAtlas::createPageTexture(const Page& page) const {
+    int pageSize = config_.pageSize;
+    auto texture = std::make_unique<GLTexture>(pageSize, pageSize, page.pixels.data(), 1);
+    texture->setFilter(true);
+    if (!useSDF_) {
+        texture->setCoverageSwizzle();
+    }
+    return texture;
+}
+
+void GLFontAtlas::resetPacker(Page& page) const {
+    page.packNodes.resize(static_cast<size_t>(config_.pageSize));
+    stbrp_init_target(&page.packContext, config_.pageSize, config_.pageSize,
+                      page.packNodes.data(), config_.pageSize);
+}
+
+bool GLFontAtlas::pack(Page& page, int width, int height, int& x, int& y) const {
+    stbrp_rect rect;
+    rect.id = 0;
+    rect.w = width + PADDING * 2;
+    rect.h = height + PADDING * 2;
+
+    stbrp_pack_rects(&page.packContext, &rect, 1);
+    if (!rect.was_packed) {
+        return false;
+    }
+    x = rect.x + PADDING;
+    y = rect.y + PADDING;
+    return true;
+}
+
+// 依次尝试已有页 -> 新建页 -> 压缩过期字形最多的页
+bool GLFontAtlas::place(int width, int height, uint32_t& page, int& x, int& y) const {
+    if (width + PADDING * 2 > config_.pageSize || height + PADDING * 2 > config_.pageSize) {
+        return false;
+    }
+
+    for (size_t i = 0; i < pages_.size(); ++i) {
+        if (pack(*pages_[i], width, height, x, y)) {
+            page = static_cast<uint32_t>(i);
+            return true;
+        }
+    }
+
+    if (static_cast<int>(pages_.size()) < config_.maxPages) {
+        Page& created = createPage();
+        page = static_cast<uint32_t>(pages_.size() - 1);
+        return pack(created, width, height, x, y);
+    }
+
+    int compacted = compactStalePage();
+    if (compacted >= 0 && pack(*pages_[compacted], width, height, x, y)) {
+        page = static_cast<uint32_t>(compacted);
+        return true;
+    }
+    return false;
 }
 
 // ============================================================================
-// 缓存字形 - 渲染字形到图集并存储信息
-// 使用 stb_rect_pack 进行矩形打包
+// 淘汰与压缩 - 选出过期字形最多的页，丢弃过期字形，存活字形重新光栅化并紧凑打包
+// 到新纹理中（整页在内存副本中拼好后一次上传），返回该页索引，没有可淘汰的字形时返回 -1
 // ============================================================================
-void GLFontAtlas::cacheGlyph(char32_t codepoint) const {
-    int advance = 0;
-    stbtt_GetCodepointHMetrics(&fontInfo_, static_cast<int>(codepoint), &advance, nullptr);
-    float advancePx = advance * scale_;
+int GLFontAtlas::compactStalePage() const {
+    uint64_t frame = g_frame.load(std::memory_order_relaxed);
+    // 阈值至少为一帧：本帧用过的字形可能已经写入了批次，不能淘汰
+    uint64_t threshold = config_.evictAfterFrames;
+    auto isStale = [&](const GlyphSlot& slot) { return frame - slot.lastUsed >= threshold; };
+    auto onPage = [](const GlyphSlot& slot) { return slot.placed && slot.glyph.width > 0.0f; };
+
+    std::vector<size_t> staleCounts(pages_.size(), 0);
+    glyphs_.forEach([&](char32_t, GlyphSlot& slot) {
+        if (onPage(slot) && isStale(slot)) {
+            staleCounts[slot.glyph.page]++;
+        }
+    });
+    auto best = std::max_element(staleCounts.begin(), staleCounts.end());
+    if (best == staleCounts.end() || *best == 0) {
+        return -1;
+    }
+    uint32_t pageIndex = static_cast<uint32_t>(best - staleCounts.begin());
 
-    if (useSDF_) {
-        constexpr int SDF_PADDING = 8;
-        constexpr unsigned char ONEDGE_VALUE = 128;
-        constexpr float PIXEL_DIST_SCALE = 64.0f;
+    // 丢弃过期字形，收集存活字形（字形表擦除其他字形不影响已有槽的地址）
+    std::vector<std::pair<char32_t, GlyphSlot*>> survivors;
+    size_t evicted = 0;
+    glyphs_.forEach([&](char32_t codepoint, GlyphSlot& slot) {
+        if (!onPage(slot) || slot.glyph.page != pageIndex) {
+            return;
+        }
+        if (isStale(slot)) {
+            glyphs_.erase(codepoint);
+            ++evicted;
+        } else {
+            survivors.emplace_back(codepoint, &slot);
+        }
+    });
+
+    // 高的字形先放，减少碎片
+    std::sort(survivors.begin(), survivors.end(), [](const auto& a, const auto& b) {
+        return a.second->glyph.height > b.second->glyph.height;
+    });
+
+    Page& page = *pages_[pageIndex];
+    retiredTextures_.push_back(std::move(page.texture));
+    retiredFrame_ = frame;
+    resetPacker(page);
+
+    std::fill(page.pixels.begin(), page.pixels.end(), 0);
+    Bitmap bitmap;
+    for (auto& [codepoint, slot] : survivors) {
+        int x = 0, y = 0;
+        if (!rasterize(codepoint, bitmap) || !pack(page, bitmap.width, bitmap.height, x, y)) {
+            glyphs_.erase(codepoint);
+            continue;
+        }
+        setGlyphCoords(slot->glyph, x, y);
+        writeGlyph(page, x, y, bitmap);
+    }
+
+    // 新纹理以完整副本创建，之前的脏区域随之作废
+    page.texture = createPageTexture(page);
+    page.clearDirty();
+
+    evictedGlyphs_ += evicted;
+    generation_.fetch_add(1, std::memory_order_release);
+    E2D_LOG_DEBUG("GLFontAtlas: compacted page {} (evicted {}, kept {})",
+                  pageIndex, evicted, survivors.size());
+    return static_cast<int>(pageIndex);
+}
+
+void GLFontAtlas::releaseRetiredTextures() const {
+    if (!retiredTextures_.empty() && g_frame.load(std::memory_order_relaxed) > retiredFrame_) {
+        retiredTextures_.clear();
+    }
+}
+
+// ============================================================================
+// 预光栅化 - 字符按块提交到线程池，工作线程只读取字体数据并写入结果队列；
+// 放入图集页和上传仍在主线程，首次用到字形时进行
+// ============================================================================
+void GLFontAtlas::prewarm(const String& text, ThreadPool* pool) {
+    if (scale_ <= 0.0f) {
+        return;
+    }
+
+    std::vector<char32_t> codepoints;
+    {
+        std::lock_guard<std::mutex> lock(prewarmQueue_->mutex);
+        for (char32_t codepoint : text.toUtf32()) {
+            if (codepoint == '\n' || glyphs_.find(codepoint) || prewarmQueue_->requested.count(codepoint) != 0) {
+                continue;
+            }
+            GlyphDiskCache::Entry entry;
+            if (diskCache_ && diskCache_->find(codepoint, entry)) {
+                continue;
+            }
+            prewarmQueue_->requested.insert(codepoint);
+            codepoints.push_back(codepoint);
+        }
+    }
+    if (codepoints.empty()) {
+        return;
+    }
+
+    if (diskCache_ && !pendingDrain_) {
+        g_drainingAtlases.push_back(this);
+        pendingDrain_ = true;
+    }
+
+    // 每块若干字符，分摊任务调度开销，同时让多个工作线程并行
+    constexpr size_t CHUNK_SIZE = 32;
+    for (size_t begin = 0; begin < codepoints.size(); begin += CHUNK_SIZE) {
+        size_t end = std::min(begin + CHUNK_SIZE, codepoints.size());
+        std::vector<char32_t> chunk(codepoints.begin() + begin, codepoints.begin() + end);
+
+        // 任务持有字体数据和结果队列，图集先于任务销毁也安全
+        auto queue = prewarmQueue_;
+        auto fontData = fontData_;
+        stbtt_fontinfo info = fontInfo_;
+        float scale = scale_;
+        bool useSDF = useSDF_;
+        queue->pendingTasks.fetch_add(1, std::memory_order_relaxed);
+
+        auto task = [queue, fontData, info, scale, useSDF, chunk = std::move(chunk)]() {
+            for (char32_t codepoint : chunk) {
+                if (queue->cancelled.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                Bitmap bitmap;
+                if (!rasterizeOutline(info, scale, useSDF, codepoint, bitmap)) {
+                    bitmap = Bitmap{};
+                }
+                std::lock_guard<std::mutex> lock(queue->mutex);
+                if (queue->requested.count(codepoint) != 0) {
+                    queue->ready.emplace(codepoint, std::move(bitmap));
+                }
+            }
+            queue->pendingTasks.fetch_sub(1, std::memory_order_release);
+        };
+
+        if (pool) {
+            pool->submit(std::move(task));
+        } else {
+            task();
+        }
+    }
+    E2D_LOG_DEBUG("GLFontAtlas: prewarming {} glyphs (size {})", codepoints.size(), fontSize_);
+}
+
+bool GLFontAtlas::isPrewarming() const {
+    return prewarmQueue_->pendingTasks.load(std::memory_order_acquire) > 0;
+}
+
+size_t GLFontAtlas::getPrewarmedGlyphCount() const {
+    std::lock_guard<std::mutex> lock(prewarmQueue_->mutex);
+    return prewarmQueue_->ready.size();
+}
+
+// 取出预光栅化结果；字符未预光栅化（或尚未完成）时返回 false。
+// 无论是否取到，字符都不再等待预光栅化：调用者随后会同步光栅化，迟到的结果被丢弃
+bool GLFontAtlas::takePrewarmed(char32_t codepoint, Bitmap& bitmap, bool& visible) const {
+    std::lock_guard<std::mutex> lock(prewarmQueue_->mutex);
+    if (prewarmQueue_->requested.erase(codepoint) == 0) {
+        return false;
+    }
+
+    auto it = prewarmQueue_->ready.find(codepoint);
+    if (it == prewarmQueue_->ready.end()) {
+        return false;
+    }
+    bitmap = std::move(it->second);
+    prewarmQueue_->ready.erase(it);
+    visible = bitmap.width > 0 && bitmap.height > 0;
+    return true;
+}
+
+bool GLFontAtlas::drainPrewarmed() {
+    if (!diskCache_) {
+        return false;
+    }
+
+    // 在锁外写文件，不阻塞仍在提交结果的工作线程
+    std::unordered_map<char32_t, Bitmap> ready;
+    bool pending = false;
+    {
+        std::lock_guard<std::mutex> lock(prewarmQueue_->mutex);
+        ready.swap(prewarmQueue_->ready);
+        for (const auto& entry : ready) {
+            prewarmQueue_->requested.erase(entry.first);
+        }
+        pending = !prewarmQueue_->requested.empty();
+    }
+
+    for (const auto& [codepoint, bitmap] : ready) {
+        diskCache_->append(codepoint, bitmap.width, bitmap.height, bitmap.xoff, bitmap.yoff,
+                           bitmap.pixels.data());
+    }
+    return pending;
+}
+
+// ============================================================================
+// 光栅化字形 - 返回 false 表示没有可见像素（如空格）
+// 依次尝试磁盘缓存、预光栅化结果，都未命中时光栅化；新结果追加到磁盘缓存
+// ============================================================================
+bool GLFontAtlas::rasterize(char32_t codepoint, Bitmap& bitmap) const {
+    bool visible = false;
+    if (!diskCache_) {
+        if (takePrewarmed(codepoint, bitmap, visible)) {
+            return visible;
+        }
+        return rasterizeOutline(fontInfo_, scale_, useSDF_, codepoint, bitmap);
+    }
+
+    GlyphDiskCache::Entry entry;
+    if (diskCache_->find(codepoint, entry)) {
+        if (entry.width <= 0 || entry.height <= 0) {
+            return false;
+        }
+        bitmap.pixels.assign(entry.pixels, entry.pixels + static_cast<size_t>(entry.width) * entry.height);
+        bitmap.width = entry.width;
+        bitmap.height = entry.height;
+        bitmap.xoff = entry.xoff;
+        bitmap.yoff = entry.yoff;
+        return true;
+    }
+
+    if (!takePrewarmed(codepoint, bitmap, visible)) {
+        visible = rasterizeOutline(fontInfo_, scale_, useSDF_, codepoint, bitmap);
+    }
+    if (!visible) {
+        diskCache_->append(codepoint, 0, 0, 0, 0, nullptr);
+        return false;
+    }
+    diskCache_->append(codepoint, bitmap.width, bitmap.height, bitmap.xoff, bitmap.yoff, bitmap.pixels.data());
+    return true;
+}
 
+bool GLFontAtlas::rasterizeOutline(const stbtt_fontinfo& info, float scale, bool useSDF,
+                                   char32_t codepoint, Bitmap& bitmap) {
+    if (useSDF) {
         int w = 0, h = 0, xoff = 0, yoff = 0;
-        unsigned char* sdf = stbtt_GetCodepointSDF(&fontInfo_,
-                                                   scale_,
+        unsigned char* sdf = stbtt_GetCodepointSDF(&info,
+                                                   scale,
                                                    static_cast<int>(codepoint),
                                                    SDF_PADDING,
                                                    ONEDGE_VALUE,
@@ -134,126 +603,149 @@ void GLFontAtlas::cacheGlyph(char32_t codepoint) const {
                                                    &w, &h, &xoff, &yoff);
         if (!sdf || w <= 0 || h <= 0) {
             if (sdf) stbtt_FreeSDF(sdf, nullptr);
-            Glyph glyph{};
-            glyph.advance = advancePx;
-            glyphs_[codepoint] = glyph;
-            return;
+            return false;
         }
 
-        stbrp_rect rect;
-        rect.id = static_cast<int>(codepoint);
-        rect.w = w + PADDING * 2;
-        rect.h = h + PADDING * 2;
-
-        stbrp_pack_rects(&packContext_, &rect, 1);
-        if (!rect.was_packed) {
-            E2D_LOG_WARN("Font atlas is full, cannot cache codepoint: {}", static_cast<int>(codepoint));
-            stbtt_FreeSDF(sdf, nullptr);
-            return;
-        }
-
-        int atlasX = rect.x + PADDING;
-        int atlasY = rect.y + PADDING;
-
-        Glyph glyph;
-        glyph.width = static_cast<float>(w);
-        glyph.height = static_cast<float>(h);
-        glyph.bearingX = static_cast<float>(xoff);
-        glyph.bearingY = static_cast<float>(yoff);
-        glyph.advance = advancePx;
-
-        // stb_rect_pack 使用左上角为原点，OpenGL纹理使用左下角为原点
-        // 需要翻转V坐标
-        float v0 = static_cast<float>(atlasY) / ATLAS_HEIGHT;
-        float v1 = static_cast<float>(atlasY + h) / ATLAS_HEIGHT;
-        glyph.u0 = static_cast<float>(atlasX) / ATLAS_WIDTH;
-        glyph.v0 = 1.0f - v1;  // 翻转V坐标
-        glyph.u1 = static_cast<float>(atlasX + w) / ATLAS_WIDTH;
-        glyph.v1 = 1.0f - v0;  // 翻转V坐标
-
-        glyphs_[codepoint] = glyph;
-
-        glBindTexture(GL_TEXTURE_2D, texture_->getTextureID());
-        GLint prevUnpackAlignment = 4;
-        glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevUnpackAlignment);
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-        // OpenGL纹理坐标原点在左下角，需要将Y坐标翻转
-        glTexSubImage2D(GL_TEXTURE_2D, 0, atlasX, ATLAS_HEIGHT - atlasY - h, w, h, GL_RED, GL_UNSIGNED_BYTE, sdf);
-        glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpackAlignment);
-
+        bitmap.pixels.assign(sdf, sdf + static_cast<size_t>(w) * h);
+        bitmap.width = w;
+        bitmap.height = h;
+        bitmap.xoff = xoff;
+        bitmap.yoff = yoff;
         stbtt_FreeSDF(sdf, nullptr);
-        return;
+        return true;
     }
 
     int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
-    stbtt_GetCodepointBitmapBox(&fontInfo_, static_cast<int>(codepoint), scale_, scale_, &x0, &y0, &x1, &y1);
+    stbtt_GetCodepointBitmapBox(&info, static_cast<int>(codepoint), scale, scale, &x0, &y0, &x1, &y1);
     int w = x1 - x0;
     int h = y1 - y0;
-    int xoff = x0;
-    int yoff = y0;
-
     if (w <= 0 || h <= 0) {
-        Glyph glyph{};
-        glyph.advance = advancePx;
-        glyphs_[codepoint] = glyph;
-        return;
+        return false;
     }
 
-    std::vector<unsigned char> bitmap(static_cast<size_t>(w) * static_cast<size_t>(h), 0);
-    stbtt_MakeCodepointBitmap(&fontInfo_, bitmap.data(), w, h, w, scale_, scale_, static_cast<int>(codepoint));
+    bitmap.pixels.assign(static_cast<size_t>(w) * static_cast<size_t>(h), 0);
+    stbtt_MakeCodepointBitmap(&info, bitmap.pixels.data(), w, h, w, scale, scale, static_cast<int>(codepoint));
+    bitmap.width = w;
+    bitmap.height = h;
+    bitmap.xoff = x0;
+    bitmap.yoff = y0;
+    return true;
+}
 
-    // 使用 stb_rect_pack 打包矩形
-    stbrp_rect rect;
-    rect.id = static_cast<int>(codepoint);
-    rect.w = w + PADDING * 2;
-    rect.h = h + PADDING * 2;
-    
-    stbrp_pack_rects(&packContext_, &rect, 1);
-    
-    if (!rect.was_packed) {
-        // 图集已满，无法缓存更多字形
-        E2D_LOG_WARN("Font atlas is full, cannot cache codepoint: {}", static_cast<int>(codepoint));
-        return;
+// ============================================================================
+// 缓存字形 - 光栅化字形、放入图集页并记录字形信息
+// ============================================================================
+GLFontAtlas::GlyphSlot& GLFontAtlas::cacheGlyph(char32_t codepoint) const {
+    releaseRetiredTextures();
+
+    int advance = 0;
+    stbtt_GetCodepointHMetrics(&fontInfo_, static_cast<int>(codepoint), &advance, nullptr);
+
+    Bitmap bitmap;
+    bool visible = rasterize(codepoint, bitmap);
+
+    // 放置可能压缩图集页并擦除其他字形，先放置再取槽
+    uint32_t page = 0;
+    int atlasX = 0, atlasY = 0;
+    bool placed = !visible || place(bitmap.width, bitmap.height, page, atlasX, atlasY);
+
+    GlyphSlot& slot = glyphs_.insert(codepoint);
+    slot.lastUsed = g_frame.load(std::memory_order_relaxed);
+    slot.glyph = Glyph{};
+    slot.glyph.advance = advance * scale_;
+    slot.placed = placed;
+
+    if (!visible) {
+        // 空白字形只需要前进距离
+        return slot;
+    }
+
+    if (!placed) {
+        if (!warnedFull_) {
+            E2D_LOG_WARN("Font atlas is full ({} pages of {}x{}), glyphs will be skipped until others expire",
+                         pages_.size(), config_.pageSize, config_.pageSize);
+            warnedFull_ = true;
+        }
+        return slot;
     }
 
-    int atlasX = rect.x + PADDING;
-    int atlasY = rect.y + PADDING;
+    Glyph& glyph = slot.glyph;
+    glyph.width = static_cast<float>(bitmap.width);
+    glyph.height = static_cast<float>(bitmap.height);
+    glyph.bearingX = static_cast<float>(bitmap.xoff);
+    glyph.bearingY = static_cast<float>(bitmap.yoff);
+    glyph.page = page;
+    setGlyphCoords(glyph, atlasX, atlasY);
 
-    // 创建字形信息
-    Glyph glyph;
-    glyph.width = static_cast<float>(w);
-    glyph.height = static_cast<float>(h);
-    glyph.bearingX = static_cast<float>(xoff);
-    glyph.bearingY = static_cast<float>(yoff);
-    glyph.advance = advancePx;
+    writeGlyph(*pages_[page], atlasX, atlasY, bitmap);
+    return slot;
+}
 
-    // 计算纹理坐标（相对于图集）
-    // stb_rect_pack 使用左上角为原点，OpenGL纹理使用左下角为原点
-    // 需要翻转V坐标
-    float v0 = static_cast<float>(atlasY) / ATLAS_HEIGHT;
-    float v1 = static_cast<float>(atlasY + h) / ATLAS_HEIGHT;
-    glyph.u0 = static_cast<float>(atlasX) / ATLAS_WIDTH;
+// 计算纹理坐标（相对于图集页）
+// stb_rect_pack 使用左上角为原点，OpenGL纹理使用左下角为原点，需要翻转V坐标
+void GLFontAtlas::setGlyphCoords(Glyph& glyph, int atlasX, int atlasY) const {
+    float pageSize = static_cast<float>(config_.pageSize);
+    float v0 = static_cast<float>(atlasY) / pageSize;
+    float v1 = static_cast<float>(atlasY + glyph.height) / pageSize;
+    glyph.u0 = static_cast<float>(atlasX) / pageSize;
     glyph.v0 = 1.0f - v1;  // 翻转V坐标
-    glyph.u1 = static_cast<float>(atlasX + w) / ATLAS_WIDTH;
+    glyph.u1 = static_cast<float>(atlasX + glyph.width) / pageSize;
     glyph.v1 = 1.0f - v0;  // 翻转V坐标
+}
 
-    // 存储字形
-    glyphs_[codepoint] = glyph;
+// 字形像素写入页的内存副本并扩大脏矩形，等待 flushUploads 统一上传
+// stb_rect_pack 以左上角为原点，纹理第 0 行在底部：字形第 0 行位于纹理的 pageSize - y - h 行
+void GLFontAtlas::writeGlyph(Page& page, int atlasX, int atlasY, const Bitmap& bitmap) const {
+    int pageSize = config_.pageSize;
+    int y = pageSize - atlasY - bitmap.height;
+    for (int row = 0; row < bitmap.height; ++row) {
+        const uint8_t* src = bitmap.pixels.data() + static_cast<size_t>(row) * bitmap.width;
+        uint8_t* dst = page.pixels.data() + static_cast<size_t>(y + row) * pageSize + atlasX;
+        std::memcpy(dst, src, static_cast<size_t>(bitmap.width));
+    }
 
-    // 将单通道字形数据转换为 RGBA 格式（白色字形，Alpha 通道存储灰度）
-    std::vector<uint8_t> rgbaData(w * h * 4);
-    for (int i = 0; i < w * h; ++i) {
-        uint8_t alpha = bitmap[static_cast<size_t>(i)];
-        rgbaData[i * 4 + 0] = 255;  // R
-        rgbaData[i * 4 + 1] = 255;  // G
-        rgbaData[i * 4 + 2] = 255;  // B
-        rgbaData[i * 4 + 3] = alpha; // A
+    if (page.isDirty()) {
+        page.dirtyMinX = std::min(page.dirtyMinX, atlasX);
+        page.dirtyMinY = std::min(page.dirtyMinY, y);
+        page.dirtyMaxX = std::max(page.dirtyMaxX, atlasX + bitmap.width);
+        page.dirtyMaxY = std::max(page.dirtyMaxY, y + bitmap.height);
+    } else {
+        page.dirtyMinX = atlasX;
+        page.dirtyMinY = y;
+        page.dirtyMaxX = atlasX + bitmap.width;
+        page.dirtyMaxY = y + bitmap.height;
     }
 
-    // 更新纹理 - 将字形数据上传到图集的指定位置
-    // OpenGL纹理坐标原点在左下角，需要将Y坐标翻转
-    glBindTexture(GL_TEXTURE_2D, texture_->getTextureID());
-    glTexSubImage2D(GL_TEXTURE_2D, 0, atlasX, ATLAS_HEIGHT - atlasY - h, w, h, GL_RGBA, GL_UNSIGNED_BYTE, rgbaData.data());
+    if (!pendingUpload_) {
+        g_pendingAtlases.push_back(this);
+        pendingUpload_ = true;
+    }
+}
+
+// 每页的脏矩形一次上传，从副本中按行拷贝到 PBO
+void GLFontAtlas::uploadDirtyPages() const {
+    int pageSize = config_.pageSize;
+    for (auto& page : pages_) {
+        if (!page->isDirty()) {
+            continue;
+        }
+
+        int x = page->dirtyMinX;
+        int y = page->dirtyMinY;
+        int width = page->dirtyMaxX - x;
+        int height = page->dirtyMaxY - y;
+        const uint8_t* pixels = page->pixels.data();
+        GLTextureUploader::instance().upload(page->texture->getTextureID(), x, y, width, height, GL_RED,
+            [=](uint8_t* dst) {
+                for (int row = 0; row < height; ++row) {
+                    std::memcpy(dst + static_cast<size_t>(row) * width,
+                                pixels + static_cast<size_t>(y + row) * pageSize + x,
+                                static_cast<size_t>(width));
+                }
+            });
+        page->clearDirty();
+    }
+    pendingUpload_ = false;
 }
 
 } // namespace easy2d
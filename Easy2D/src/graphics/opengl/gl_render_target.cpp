@@ -0,0 +1,45 @@
+#include <easy2d/graphics/opengl/gl_render_target.h>
+#include <easy2d/graphics/opengl/gl_texture.h>
+#include <easy2d/utils/logger.h>
+
+namespace easy2d {
+
+GLRenderTarget::GLRenderTarget(int width, int height)
+    : framebuffer_(0), width_(width), height_(height) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    // 颜色纹理只在 GPU 上写入，不需要初始数据；缩放绘制时使用线性过滤
+    texture_ = makePtr<GLTexture>(width, height, nullptr, 4);
+    texture_->setFilter(true);
+
+    GLint prevFramebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &prevFramebuffer);
+
+    glGenFramebuffers(1, &framebuffer_);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer_);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture_->getTextureID(), 0);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(prevFramebuffer));
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        E2D_LOG_ERROR("GLRenderTarget: framebuffer incomplete (0x{:x}), {}x{}", status, width, height);
+        glDeleteFramebuffers(1, &framebuffer_);
+        framebuffer_ = 0;
+        texture_.reset();
+    }
+}
+
+GLRenderTarget::~GLRenderTarget() {
+    if (framebuffer_ != 0) {
+        glDeleteFramebuffers(1, &framebuffer_);
+    }
+}
+
+Ptr<Texture> GLRenderTarget::getTexture() const {
+    return texture_;
+}
+
+} // namespace easy2d
@@ -1,34 +1,24 @@
 #include <easy2d/graphics/opengl/gl_renderer.h>
 #include <easy2d/graphics/opengl/gl_texture.h>
 #include <easy2d/graphics/opengl/gl_font_atlas.h>
+#include <easy2d/graphics/opengl/gl_state_cache.h>
+#include <easy2d/graphics/opengl/gl_static_sprite_buffer.h>
+#include <easy2d/graphics/opengl/gl_render_target.h>
+#include <easy2d/graphics/opengl/gl_texture_uploader.h>
+#include <easy2d/graphics/glyph_run.h>
 #include <easy2d/platform/window.h>
 #include <easy2d/utils/logger.h>
 #include <GLFW/glfw3.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
 namespace easy2d {
 
-// 形状渲染着色器
-static const char* SHAPE_VERTEX_SHADER = R"(
-#version 330 core
-layout(location = 0) in vec2 aPosition;
-uniform mat4 uViewProjection;
-void main() {
-    gl_Position = uViewProjection * vec4(aPosition, 0.0, 1.0);
-}
-)";
-
-static const char* SHAPE_FRAGMENT_SHADER = R"(
-#version 330 core
-uniform vec4 uColor;
-out vec4 fragColor;
-void main() {
-    fragColor = uColor;
-}
-)";
-
-GLRenderer::GLRenderer() : window_(nullptr), shapeVao_(0), shapeVbo_(0), vsync_(true) {
+GLRenderer::GLRenderer()
+    : window_(nullptr), batchActive_(false), viewport_{ 0, 0, 0, 0 }
+    , blendMode_(BlendMode::Alpha), vsync_(true) {
     resetStats();
 }
 
@@ -46,6 +36,9 @@ bool GLRenderer::init(Window* window) {
         return false;
     }
 
+    // 新上下文的状态未知，清空状态缓存
+    GLStateCache::instance().invalidate();
+
     // 初始化精灵批渲染器
     if (!spriteBatch_.init()) {
         E2D_LOG_ERROR("Failed to initialize sprite batch");
@@ -53,11 +46,14 @@ bool GLRenderer::init(Window* window) {
     }
 
     // 初始化形状渲染
-    initShapeRendering();
+    if (!initShapeRendering()) {
+        E2D_LOG_ERROR("Failed to initialize shape rendering");
+        return false;
+    }
 
     // 设置 OpenGL 状态
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    blendMode_ = BlendMode::Alpha;
+    setupBlendMode(blendMode_);
     
     E2D_LOG_INFO("OpenGL Renderer initialized");
     E2D_LOG_INFO("OpenGL Version: {}", reinterpret_cast<const char*>(glGetString(GL_VERSION)));
@@ -66,30 +62,77 @@ bool GLRenderer::init(Window* window) {
 }
 
 void GLRenderer::shutdown() {
+    setRenderTarget(nullptr);
     spriteBatch_.shutdown();
-    
-    if (shapeVbo_ != 0) {
-        glDeleteBuffers(1, &shapeVbo_);
-        shapeVbo_ = 0;
-    }
-    if (shapeVao_ != 0) {
-        glDeleteVertexArrays(1, &shapeVao_);
-        shapeVao_ = 0;
-    }
+    whiteTexture_.reset();
+    GLTextureUploader::instance().shutdown();
+    batchActive_ = false;
 }
 
 void GLRenderer::beginFrame(const Color& clearColor) {
-    glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
-    glClear(GL_COLOR_BUFFER_BIT);
+    clear(clearColor);
     resetStats();
 }
 
+void GLRenderer::clear(const Color& color) {
+    glClearColor(color.r, color.g, color.b, color.a);
+    glClear(GL_COLOR_BUFFER_BIT);
+}
+
 void GLRenderer::endFrame() {
+    // 提交剩余批次并轮转精灵批处理的环形缓冲区
+    endSpriteBatch();
+    spriteBatch_.endFrame();
+    GLFontAtlas::advanceFrame();
     // 交换缓冲区在 Window 类中处理
 }
 
 void GLRenderer::setViewport(int x, int y, int width, int height) {
-    glViewport(x, y, width, height);
+    viewport_[0] = x;
+    viewport_[1] = y;
+    viewport_[2] = width;
+    viewport_[3] = height;
+    if (!renderTarget_) {
+        glViewport(x, y, width, height);
+    }
+}
+
+// ============================================================================
+// 渲染目标
+// ============================================================================
+Ptr<RenderTarget> GLRenderer::createRenderTarget(int width, int height) {
+    auto target = makePtr<GLRenderTarget>(width, height);
+    return target->isValid() ? target : nullptr;
+}
+
+void GLRenderer::setRenderTarget(Ptr<RenderTarget> target) {
+    if (target == renderTarget_) return;
+
+    // 已累积的绘制属于之前的目标
+    bool resumeBatch = batchActive_;
+    endSpriteBatch();
+
+    renderTarget_ = std::move(target);
+    if (renderTarget_) {
+        auto* glTarget = static_cast<GLRenderTarget*>(renderTarget_.get());
+        glBindFramebuffer(GL_FRAMEBUFFER, glTarget->getFramebufferID());
+        glViewport(0, 0, glTarget->getWidth(), glTarget->getHeight());
+    } else {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(viewport_[0], viewport_[1], viewport_[2], viewport_[3]);
+    }
+
+    if (resumeBatch) {
+        beginSpriteBatch();
+    }
+}
+
+// 绘制到渲染目标时上下翻转，使其纹理与图片纹理一样第 0 行为画面顶部
+glm::mat4 GLRenderer::getEffectiveViewProjection() const {
+    if (!renderTarget_) {
+        return viewProjection_;
+    }
+    return glm::scale(glm::mat4(1.0f), glm::vec3(1.0f, -1.0f, 1.0f)) * viewProjection_;
 }
 
 void GLRenderer::setVSync(bool enabled) {
@@ -98,27 +141,42 @@ void GLRenderer::setVSync(bool enabled) {
 }
 
 void GLRenderer::setBlendMode(BlendMode mode) {
+    // 混合模式不变时不打断批次
+    if (mode == blendMode_) return;
+
+    // 混合状态改变前提交已累积的顶点
+    if (batchActive_) {
+        spriteBatch_.end();
+    }
+    blendMode_ = mode;
+    setupBlendMode(mode);
+}
+
+// 目标 Alpha 统一按 (ONE, ONE_MINUS_SRC_ALPHA) 累积：绘制到不透明的渲染目标后
+// Alpha 保持为 1，快照作为纹理混合到屏幕时半透明和抗锯齿边缘不会变淡
+void GLRenderer::setupBlendMode(BlendMode mode) {
+    GLStateCache& state = GLStateCache::instance();
     switch (mode) {
         case BlendMode::None:
-            glDisable(GL_BLEND);
+            state.setBlend(false);
             break;
         case BlendMode::Alpha:
-            glEnable(GL_BLEND);
-            glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+            state.setBlend(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
             break;
         case BlendMode::Additive:
-            glEnable(GL_BLEND);
-            glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+            state.setBlend(true, GL_SRC_ALPHA, GL_ONE, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
             break;
         case BlendMode::Multiply:
-            glEnable(GL_BLEND);
-            glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA);
+            state.setBlend(true, GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
             break;
     }
 }
 
 void GLRenderer::setViewProjection(const glm::mat4& matrix) {
     viewProjection_ = matrix;
+    if (batchActive_) {
+        spriteBatch_.setViewProjection(getEffectiveViewProjection());
+    }
 }
 
 Ptr<Texture> GLRenderer::createTexture(int width, int height, const uint8_t* pixels, int channels) {
@@ -130,38 +188,30 @@ Ptr<Texture> GLRenderer::loadTexture(const std::string& filepath) {
 }
 
 void GLRenderer::beginSpriteBatch() {
-    spriteBatch_.begin(viewProjection_);
+    if (batchActive_) {
+        endSpriteBatch();
+    }
+    spriteBatch_.begin(getEffectiveViewProjection());
+    batchActive_ = true;
+}
+
+void GLRenderer::ensureSpriteBatch() {
+    if (!batchActive_) {
+        beginSpriteBatch();
+    }
 }
 
 void GLRenderer::drawSprite(const Texture& texture, const Rect& destRect, const Rect& srcRect,
                            const Color& tint, float rotation, const Vec2& anchor) {
-    GLSpriteBatch::SpriteData data;
-    data.position = glm::vec2(destRect.origin.x, destRect.origin.y);
-    data.size = glm::vec2(destRect.size.width, destRect.size.height);
-    
-    Texture* tex = const_cast<Texture*>(&texture);
-    float texW = static_cast<float>(tex->getWidth());
-    float texH = static_cast<float>(tex->getHeight());
-    
-    // 纹理坐标计算
-    // OpenGL纹理坐标系：原点在左下角，V向上增加
-    // 图片数据：原点在左上角，Y向下增加
-    // 因此需要翻转V坐标：v' = 1 - v
-    float u1 = srcRect.origin.x / texW;
-    float u2 = (srcRect.origin.x + srcRect.size.width) / texW;
-    // 翻转V坐标
-    float v1 = 1.0f - (srcRect.origin.y / texH);
-    float v2 = 1.0f - ((srcRect.origin.y + srcRect.size.height) / texH);
-    
-    data.texCoordMin = glm::vec2(std::min(u1, u2), std::min(v1, v2));
-    data.texCoordMax = glm::vec2(std::max(u1, u2), std::max(v1, v2));
-    
-    data.color = glm::vec4(tint.r, tint.g, tint.b, tint.a);
-    data.rotation = rotation * 3.14159f / 180.0f;
-    data.anchor = glm::vec2(anchor.x, anchor.y);
-    data.isSDF = false;
-    
-    spriteBatch_.draw(texture, data);
+    // 图集区域换算到所在的页纹理上，同一页中的区域共用纹理槽
+    const Texture& source = texture.getSourceTexture();
+    Rect sourceRect = srcRect;
+    sourceRect.origin += texture.getSourceOffset();
+
+    GLSpriteBatch::SpriteData data = GLSpriteBatch::makeSpriteData(source, destRect, sourceRect,
+                                                                   tint, rotation, anchor);
+    ensureSpriteBatch();
+    spriteBatch_.draw(source, data);
 }
 
 void GLRenderer::drawSprite(const Texture& texture, const Vec2& position, const Color& tint) {
@@ -172,113 +222,134 @@ void GLRenderer::drawSprite(const Texture& texture, const Vec2& position, const
 }
 
 void GLRenderer::endSpriteBatch() {
+    if (!batchActive_) return;
+    batchActive_ = false;
+
     spriteBatch_.end();
     stats_.drawCalls += spriteBatch_.getDrawCallCount();
+    stats_.triangleCount += spriteBatch_.getSpriteCount() * 2;
+    stats_.spriteBatches += spriteBatch_.getDrawCallCount();
+    stats_.batchBreaks += spriteBatch_.getBatchBreakCount();
+}
+
+void GLRenderer::setSpriteRenderPath(SpriteRenderPath path) {
+    // 切换时提交已写入的批次，之后的精灵使用新路径
+    spriteBatch_.setInstancingEnabled(path == SpriteRenderPath::Instanced);
+}
+
+SpriteRenderPath GLRenderer::getSpriteRenderPath() const {
+    return spriteBatch_.isInstancingEnabled() ? SpriteRenderPath::Instanced : SpriteRenderPath::Vertices;
+}
+
+Ptr<StaticSpriteBuffer> GLRenderer::createStaticSpriteBuffer() {
+    return makePtr<GLStaticSpriteBuffer>();
+}
+
+void GLRenderer::drawStaticSprites(const StaticSpriteBuffer& buffer, const glm::mat4& transform) {
+    // 经由精灵批次绘制，统计信息随批次一并汇总
+    ensureSpriteBatch();
+    spriteBatch_.drawStatic(static_cast<const GLStaticSpriteBuffer&>(buffer), transform);
+}
+
+// ============================================================================
+// 形状渲染 - 所有形状都拆成四边形，使用白色纹理写入精灵批次
+// ============================================================================
+
+void GLRenderer::pushShapeQuad(const glm::vec2& v0, const glm::vec2& v1,
+                               const glm::vec2& v2, const glm::vec2& v3, uint32_t color) {
+    ensureSpriteBatch();
+    const glm::vec2 positions[4] = { v0, v1, v2, v3 };
+    spriteBatch_.drawQuad(*whiteTexture_, positions, glm::vec2(0.5f, 0.5f), color);
+}
+
+void GLRenderer::pushShapeFan(const glm::vec2& pivot, const glm::vec2* rim, size_t count, uint32_t color) {
+    // 扇形的相邻两个三角形 (pivot, r[i], r[i+1])、(pivot, r[i+1], r[i+2]) 合成一个四边形
+    size_t i = 0;
+    for (; i + 2 < count; i += 2) {
+        pushShapeQuad(pivot, rim[i], rim[i + 1], rim[i + 2], color);
+    }
+    if (i + 1 < count) {
+        // 剩余一个三角形，用退化四边形提交
+        pushShapeQuad(pivot, rim[i], rim[i + 1], rim[i + 1], color);
+    }
 }
 
 void GLRenderer::drawLine(const Vec2& start, const Vec2& end, const Color& color, float width) {
-    glLineWidth(width);
-    
-    shapeShader_.bind();
-    shapeShader_.setMat4("uViewProjection", viewProjection_);
-    shapeShader_.setVec4("uColor", glm::vec4(color.r, color.g, color.b, color.a));
-    
-    float vertices[] = { start.x, start.y, end.x, end.y };
-    
-    glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-    
-    glBindVertexArray(shapeVao_);
-    glDrawArrays(GL_LINES, 0, 2);
-    
-    stats_.drawCalls++;
-    stats_.triangleCount += 1;
+    glm::vec2 a(start.x, start.y);
+    glm::vec2 b(end.x, end.y);
+    glm::vec2 dir = b - a;
+    float length = std::sqrt(dir.x * dir.x + dir.y * dir.y);
+    if (length <= 0.0f) return;
+
+    // 沿法线方向扩展为宽度为 width 的四边形
+    float halfWidth = std::max(width, 1.0f) * 0.5f;
+    glm::vec2 normal(-dir.y / length * halfWidth, dir.x / length * halfWidth);
+    pushShapeQuad(a + normal, b + normal, b - normal, a - normal, GLSpriteBatch::packColor(color));
 }
 
 void GLRenderer::drawRect(const Rect& rect, const Color& color, float width) {
+    // 四条边各一个四边形，外扩/内缩半个线宽，拐角不重叠
+    float hw = std::max(width, 1.0f) * 0.5f;
+    float ox1 = rect.origin.x - hw;
+    float oy1 = rect.origin.y - hw;
+    float ox2 = rect.origin.x + rect.size.width + hw;
+    float oy2 = rect.origin.y + rect.size.height + hw;
+    float ix1 = rect.origin.x + hw;
+    float iy1 = rect.origin.y + hw;
+    float ix2 = rect.origin.x + rect.size.width - hw;
+    float iy2 = rect.origin.y + rect.size.height - hw;
+    uint32_t packed = GLSpriteBatch::packColor(color);
+
+    pushShapeQuad({ox1, oy1}, {ox2, oy1}, {ox2, iy1}, {ox1, iy1}, packed);  // 上
+    pushShapeQuad({ox1, iy2}, {ox2, iy2}, {ox2, oy2}, {ox1, oy2}, packed);  // 下
+    if (iy2 > iy1) {
+        pushShapeQuad({ox1, iy1}, {ix1, iy1}, {ix1, iy2}, {ox1, iy2}, packed);  // 左
+        pushShapeQuad({ix2, iy1}, {ox2, iy1}, {ox2, iy2}, {ix2, iy2}, packed);  // 右
+    }
+}
+
+void GLRenderer::fillRect(const Rect& rect, const Color& color) {
     float x1 = rect.origin.x;
     float y1 = rect.origin.y;
     float x2 = rect.origin.x + rect.size.width;
     float y2 = rect.origin.y + rect.size.height;
-    
-    drawLine(Vec2(x1, y1), Vec2(x2, y1), color, width);
-    drawLine(Vec2(x2, y1), Vec2(x2, y2), color, width);
-    drawLine(Vec2(x2, y2), Vec2(x1, y2), color, width);
-    drawLine(Vec2(x1, y2), Vec2(x1, y1), color, width);
-}
-
-void GLRenderer::fillRect(const Rect& rect, const Color& color) {
-    shapeShader_.bind();
-    shapeShader_.setMat4("uViewProjection", viewProjection_);
-    shapeShader_.setVec4("uColor", glm::vec4(color.r, color.g, color.b, color.a));
-    
-    float vertices[] = {
-        rect.origin.x, rect.origin.y,
-        rect.origin.x + rect.size.width, rect.origin.y,
-        rect.origin.x + rect.size.width, rect.origin.y + rect.size.height,
-        rect.origin.x, rect.origin.y + rect.size.height
-    };
-    
-    glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-    
-    glBindVertexArray(shapeVao_);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
-    
-    stats_.drawCalls++;
-    stats_.triangleCount += 2;
+    pushShapeQuad({x1, y1}, {x2, y1}, {x2, y2}, {x1, y2}, GLSpriteBatch::packColor(color));
 }
 
 void GLRenderer::drawCircle(const Vec2& center, float radius, const Color& color, int segments, float width) {
-    std::vector<float> vertices;
-    vertices.reserve((segments + 1) * 2);
-    
-    for (int i = 0; i <= segments; ++i) {
+    if (segments < 3) return;
+
+    // 每段为内外半径之间的一个四边形
+    float hw = std::max(width, 1.0f) * 0.5f;
+    float inner = std::max(radius - hw, 0.0f);
+    float outer = radius + hw;
+    uint32_t packed = GLSpriteBatch::packColor(color);
+
+    float prevCos = 1.0f;
+    float prevSin = 0.0f;
+    for (int i = 1; i <= segments; ++i) {
         float angle = 2.0f * 3.14159f * i / segments;
-        vertices.push_back(center.x + radius * cosf(angle));
-        vertices.push_back(center.y + radius * sinf(angle));
+        float c = cosf(angle);
+        float s = sinf(angle);
+        pushShapeQuad({center.x + outer * prevCos, center.y + outer * prevSin},
+                      {center.x + outer * c, center.y + outer * s},
+                      {center.x + inner * c, center.y + inner * s},
+                      {center.x + inner * prevCos, center.y + inner * prevSin}, packed);
+        prevCos = c;
+        prevSin = s;
     }
-    
-    glLineWidth(width);
-    
-    shapeShader_.bind();
-    shapeShader_.setMat4("uViewProjection", viewProjection_);
-    shapeShader_.setVec4("uColor", glm::vec4(color.r, color.g, color.b, color.a));
-    
-    glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-    
-    glBindVertexArray(shapeVao_);
-    glDrawArrays(GL_LINE_STRIP, 0, segments + 1);
-    
-    stats_.drawCalls++;
 }
 
 void GLRenderer::fillCircle(const Vec2& center, float radius, const Color& color, int segments) {
-    std::vector<float> vertices;
-    vertices.reserve((segments + 2) * 2);
-    
-    vertices.push_back(center.x);
-    vertices.push_back(center.y);
-    
+    if (segments < 3) return;
+
+    shapeScratch_.clear();
     for (int i = 0; i <= segments; ++i) {
         float angle = 2.0f * 3.14159f * i / segments;
-        vertices.push_back(center.x + radius * cosf(angle));
-        vertices.push_back(center.y + radius * sinf(angle));
+        shapeScratch_.emplace_back(center.x + radius * cosf(angle), center.y + radius * sinf(angle));
     }
-    
-    shapeShader_.bind();
-    shapeShader_.setMat4("uViewProjection", viewProjection_);
-    shapeShader_.setVec4("uColor", glm::vec4(color.r, color.g, color.b, color.a));
-    
-    glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-    
-    glBindVertexArray(shapeVao_);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, segments + 2);
-    
-    stats_.drawCalls++;
-    stats_.triangleCount += segments;
+    pushShapeFan(glm::vec2(center.x, center.y), shapeScratch_.data(), shapeScratch_.size(),
+                 GLSpriteBatch::packColor(color));
 }
 
 void GLRenderer::drawTriangle(const Vec2& p1, const Vec2& p2, const Vec2& p3, const Color& color, float width) {
@@ -288,20 +359,7 @@ void GLRenderer::drawTriangle(const Vec2& p1, const Vec2& p2, const Vec2& p3, co
 }
 
 void GLRenderer::fillTriangle(const Vec2& p1, const Vec2& p2, const Vec2& p3, const Color& color) {
-    shapeShader_.bind();
-    shapeShader_.setMat4("uViewProjection", viewProjection_);
-    shapeShader_.setVec4("uColor", glm::vec4(color.r, color.g, color.b, color.a));
-    
-    float vertices[] = { p1.x, p1.y, p2.x, p2.y, p3.x, p3.y };
-    
-    glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-    
-    glBindVertexArray(shapeVao_);
-    glDrawArrays(GL_TRIANGLES, 0, 3);
-    
-    stats_.drawCalls++;
-    stats_.triangleCount += 1;
+    pushShapeQuad({p1.x, p1.y}, {p2.x, p2.y}, {p3.x, p3.y}, {p3.x, p3.y}, GLSpriteBatch::packColor(color));
 }
 
 void GLRenderer::drawPolygon(const std::vector<Vec2>& points, const Color& color, float width) {
@@ -313,25 +371,13 @@ void GLRenderer::drawPolygon(const std::vector<Vec2>& points, const Color& color
 void GLRenderer::fillPolygon(const std::vector<Vec2>& points, const Color& color) {
     // 简化的三角形扇形填充
     if (points.size() < 3) return;
-    
-    shapeShader_.bind();
-    shapeShader_.setMat4("uViewProjection", viewProjection_);
-    shapeShader_.setVec4("uColor", glm::vec4(color.r, color.g, color.b, color.a));
-    
-    std::vector<float> vertices;
-    for (const auto& p : points) {
-        vertices.push_back(p.x);
-        vertices.push_back(p.y);
+
+    shapeScratch_.clear();
+    for (size_t i = 1; i < points.size(); ++i) {
+        shapeScratch_.emplace_back(points[i].x, points[i].y);
     }
-    
-    glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_DYNAMIC_DRAW);
-    
-    glBindVertexArray(shapeVao_);
-    glDrawArrays(GL_TRIANGLE_FAN, 0, static_cast<GLsizei>(points.size()));
-    
-    stats_.drawCalls++;
-    stats_.triangleCount += static_cast<uint32_t>(points.size() - 2);
+    pushShapeFan(glm::vec2(points[0].x, points[0].y), shapeScratch_.data(), shapeScratch_.size(),
+                 GLSpriteBatch::packColor(color));
 }
 
 Ptr<FontAtlas> GLRenderer::createFontAtlas(const std::string& filepath, int fontSize, bool useSDF) {
@@ -348,7 +394,9 @@ void GLRenderer::drawText(const FontAtlas& font, const String& text, float x, fl
     // 在屏幕坐标系中，Y轴向下，基线在字形下方
     // ascent是正值（向上），descent是负值（向下）
     float baselineY = cursorY + font.getAscent();
+    uint32_t packed = GLSpriteBatch::packColor(color);
     
+    ensureSpriteBatch();
     for (char32_t codepoint : text.toUtf32()) {
         if (codepoint == '\n') {
             cursorX = x;
@@ -381,35 +429,59 @@ void GLRenderer::drawText(const FontAtlas& font, const String& text, float x, fl
             data.size = glm::vec2(destRect.size.width, destRect.size.height);
             data.texCoordMin = glm::vec2(glyph->u0, glyph->v0);
             data.texCoordMax = glm::vec2(glyph->u1, glyph->v1);
-            data.color = glm::vec4(color.r, color.g, color.b, color.a);
+            data.color = packed;
             data.rotation = 0.0f;
             data.anchor = glm::vec2(0.0f, 0.0f);
             data.isSDF = font.isSDF();
-            spriteBatch_.draw(*font.getTexture(), data);
+            if (Texture* page = font.getPageTexture(glyph->page)) {
+                spriteBatch_.draw(*page, data);
+            }
         }
     }
 }
 
+void GLRenderer::drawGlyphRun(const GlyphRun& run, const Vec2& position, const Color& color) {
+    if (run.empty()) {
+        return;
+    }
+
+    GLSpriteBatch::SpriteData data;
+    data.color = GLSpriteBatch::packColor(color);
+    data.rotation = 0.0f;
+    data.anchor = glm::vec2(0.0f, 0.0f);
+    data.isSDF = run.isSDF();
+
+    ensureSpriteBatch();
+    for (const GlyphRun::Quad& quad : run.getQuads()) {
+        data.position = glm::vec2(position.x + quad.rect.origin.x, position.y + quad.rect.origin.y);
+        data.size = glm::vec2(quad.rect.size.width, quad.rect.size.height);
+        data.texCoordMin = glm::vec2(quad.u0, quad.v0);
+        data.texCoordMax = glm::vec2(quad.u1, quad.v1);
+        spriteBatch_.draw(*quad.texture, data);
+    }
+}
+
+GLRenderer::Stats GLRenderer::getStats() const {
+    // 绑定次数由状态缓存统计，只计入实际发出的 GL 调用
+    Stats stats = stats_;
+    const GLStateCache& state = GLStateCache::instance();
+    stats.textureBinds = state.getTextureBindCount();
+    stats.shaderBinds = state.getShaderBindCount();
+    stats.textureMemory = GLTexture::getTotalGpuMemoryUsage();
+    return stats;
+}
+
 void GLRenderer::resetStats() {
     stats_ = Stats{};
+    GLStateCache::instance().resetCounters();
 }
 
-void GLRenderer::initShapeRendering() {
-    // 编译形状着色器
-    shapeShader_.compileFromSource(SHAPE_VERTEX_SHADER, SHAPE_FRAGMENT_SHADER);
-    
-    // 创建 VAO 和 VBO
-    glGenVertexArrays(1, &shapeVao_);
-    glGenBuffers(1, &shapeVbo_);
-    
-    glBindVertexArray(shapeVao_);
-    glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
-    glBufferData(GL_ARRAY_BUFFER, 1024 * sizeof(float), nullptr, GL_DYNAMIC_DRAW);
-    
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), nullptr);
-    
-    glBindVertexArray(0);
+bool GLRenderer::initShapeRendering() {
+    // 1x1 白色纹理：形状以纯色顶点采样白色纹素，与精灵共用同一着色器和批次
+    const uint8_t white[4] = { 255, 255, 255, 255 };
+    whiteTexture_ = makePtr<GLTexture>(1, 1, white, 4);
+    shapeScratch_.reserve(256);
+    return whiteTexture_->getNativeHandle() != nullptr;
 }
 
 } // namespace easy2d
@@ -1,5 +1,7 @@
 #include <easy2d/graphics/opengl/gl_shader.h>
+#include <easy2d/graphics/opengl/gl_state_cache.h>
 #include <easy2d/utils/logger.h>
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
@@ -9,12 +11,23 @@ GLShader::GLShader() : programID_(0) {
 }
 
 GLShader::~GLShader() {
+    release();
+}
+
+void GLShader::release() {
     if (programID_ != 0) {
+        GLStateCache::instance().forgetProgram(programID_);
         glDeleteProgram(programID_);
+        programID_ = 0;
     }
+    uniformCache_.clear();
+    valueSlots_.clear();
+    values_.clear();
 }
 
 bool GLShader::compileFromSource(const char* vertexSource, const char* fragmentSource) {
+    release();
+
     GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource);
     if (vertexShader == 0) return false;
 
@@ -42,6 +55,9 @@ bool GLShader::compileFromSource(const char* vertexSource, const char* fragmentS
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
+    if (success == GL_TRUE) {
+        resolveUniforms();
+    }
     return success == GL_TRUE;
 }
 
@@ -62,39 +78,123 @@ bool GLShader::compileFromFile(const std::string& vertexPath, const std::string&
 }
 
 void GLShader::bind() const {
-    glUseProgram(programID_);
+    GLStateCache::instance().useProgram(programID_);
 }
 
 void GLShader::unbind() const {
-    glUseProgram(0);
+    GLStateCache::instance().useProgram(0);
+}
+
+// ============================================================================
+// 链接后解析所有活动 uniform 的位置，并为每个位置分配值缓存
+// 数组 uniform 的每个元素单独登记（"name[i]"，首元素同时登记为 "name"）
+// ============================================================================
+void GLShader::resolveUniforms() {
+    GLint count = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(programID_, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(programID_, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    std::string buffer(static_cast<size_t>(std::max(maxNameLength, 1)), '\0');
+    auto registerLocation = [this](const std::string& name, GLint location) {
+        uniformCache_[name] = location;
+        if (location < 0) return;
+        if (static_cast<size_t>(location) >= valueSlots_.size()) {
+            valueSlots_.resize(static_cast<size_t>(location) + 1, -1);
+        }
+        if (valueSlots_[location] < 0) {
+            valueSlots_[location] = static_cast<int32_t>(values_.size());
+            values_.emplace_back();
+        }
+    };
+
+    for (GLint i = 0; i < count; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(programID_, static_cast<GLuint>(i), static_cast<GLsizei>(buffer.size()),
+                           &length, &size, &type, &buffer[0]);
+        std::string name(buffer.data(), static_cast<size_t>(length));
+
+        // 数组名以 "[0]" 结尾，去掉后逐个元素查询位置
+        size_t bracket = name.find('[');
+        if (bracket != std::string::npos) {
+            name.resize(bracket);
+        }
+        if (size <= 1 && bracket == std::string::npos) {
+            registerLocation(name, glGetUniformLocation(programID_, name.c_str()));
+            continue;
+        }
+        for (GLint element = 0; element < size; ++element) {
+            std::string elementName = name + "[" + std::to_string(element) + "]";
+            GLint location = glGetUniformLocation(programID_, elementName.c_str());
+            registerLocation(elementName, location);
+            if (element == 0) {
+                registerLocation(name, location);
+            }
+        }
+    }
+}
+
+void GLShader::setInt(GLint location, int value) {
+    if (updateValue(location, value)) {
+        glUniform1i(location, value);
+    }
+}
+
+void GLShader::setFloat(GLint location, float value) {
+    if (updateValue(location, value)) {
+        glUniform1f(location, value);
+    }
+}
+
+void GLShader::setVec2(GLint location, const glm::vec2& value) {
+    if (updateValue(location, value)) {
+        glUniform2fv(location, 1, &value[0]);
+    }
+}
+
+void GLShader::setVec4(GLint location, const glm::vec4& value) {
+    if (updateValue(location, value)) {
+        glUniform4fv(location, 1, &value[0]);
+    }
+}
+
+void GLShader::setMat4(GLint location, const glm::mat4& value) {
+    if (updateValue(location, value)) {
+        glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]);
+    }
 }
 
 void GLShader::setBool(const std::string& name, bool value) {
-    glUniform1i(getUniformLocation(name), value ? 1 : 0);
+    setInt(getUniformLocation(name), value ? 1 : 0);
 }
 
 void GLShader::setInt(const std::string& name, int value) {
-    glUniform1i(getUniformLocation(name), value);
+    setInt(getUniformLocation(name), value);
 }
 
 void GLShader::setFloat(const std::string& name, float value) {
-    glUniform1f(getUniformLocation(name), value);
+    setFloat(getUniformLocation(name), value);
 }
 
 void GLShader::setVec2(const std::string& name, const glm::vec2& value) {
-    glUniform2fv(getUniformLocation(name), 1, &value[0]);
+    setVec2(getUniformLocation(name), value);
 }
 
 void GLShader::setVec3(const std::string& name, const glm::vec3& value) {
-    glUniform3fv(getUniformLocation(name), 1, &value[0]);
+    GLint location = getUniformLocation(name);
+    if (updateValue(location, value)) {
+        glUniform3fv(location, 1, &value[0]);
+    }
 }
 
 void GLShader::setVec4(const std::string& name, const glm::vec4& value) {
-    glUniform4fv(getUniformLocation(name), 1, &value[0]);
+    setVec4(getUniformLocation(name), value);
 }
 
 void GLShader::setMat4(const std::string& name, const glm::mat4& value) {
-    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, &value[0][0]);
+    setMat4(getUniformLocation(name), value);
 }
 
 GLuint GLShader::compileShader(GLenum type, const char* source) {
@@ -115,15 +215,10 @@ GLuint GLShader::compileShader(GLenum type, const char* source) {
     return shader;
 }
 
-GLint GLShader::getUniformLocation(const std::string& name) {
+GLint GLShader::getUniformLocation(const std::string& name) const {
+    // 所有活动 uniform 已在链接后登记，未登记的名称在程序中不存在（或被优化掉）
     auto it = uniformCache_.find(name);
-    if (it != uniformCache_.end()) {
-        return it->second;
-    }
-
-    GLint location = glGetUniformLocation(programID_, name.c_str());
-    uniformCache_[name] = location;
-    return location;
+    return it != uniformCache_.end() ? it->second : -1;
 }
 
 } // namespace easy2d
@@ -1,7 +1,12 @@
 #include <easy2d/graphics/opengl/gl_sprite_batch.h>
+#include <easy2d/graphics/opengl/gl_font_atlas.h>
+#include <easy2d/graphics/opengl/gl_state_cache.h>
+#include <easy2d/graphics/opengl/gl_static_sprite_buffer.h>
 #include <easy2d/utils/logger.h>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <cstring>
+#include <string>
 
 namespace easy2d {
 
@@ -11,49 +16,89 @@ static const char* SPRITE_VERTEX_SHADER = R"(
 layout(location = 0) in vec2 aPosition;
 layout(location = 1) in vec2 aTexCoord;
 layout(location = 2) in vec4 aColor;
+layout(location = 3) in uint aTexIndex;
 
 uniform mat4 uViewProjection;
 
 out vec2 vTexCoord;
 out vec4 vColor;
+flat out uint vTexIndex;
 
 void main() {
     gl_Position = uViewProjection * vec4(aPosition, 0.0, 1.0);
     vTexCoord = aTexCoord;
     vColor = aColor;
+    vTexIndex = aTexIndex;
 }
 )";
 
-// 片段着色器
-static const char* SPRITE_FRAGMENT_SHADER = R"(
+// 实例化顶点着色器：按实例记录展开单位四边形，变换与顶点路径的 CPU 计算一致
+static const char* SPRITE_INSTANCE_VERTEX_SHADER = R"(
 #version 330 core
+layout(location = 0) in vec2 aCorner;
+layout(location = 1) in vec2 iPosition;
+layout(location = 2) in vec2 iSize;
+layout(location = 3) in vec2 iAnchor;
+layout(location = 4) in vec4 iTexRect;
+layout(location = 5) in vec4 iColor;
+layout(location = 6) in float iRotation;
+layout(location = 7) in uint iTexIndex;
+
+uniform mat4 uViewProjection;
+
+out vec2 vTexCoord;
+out vec4 vColor;
+flat out uint vTexIndex;
+
+void main() {
+    vec2 local = (aCorner - iAnchor) * iSize;
+    float c = cos(iRotation);
+    float s = sin(iRotation);
+    vec2 world = iPosition + vec2(local.x * c - local.y * s, local.x * s + local.y * c);
+    gl_Position = uViewProjection * vec4(world, 0.0, 1.0);
+    vTexCoord = mix(iTexRect.xy, iTexRect.zw, aCorner);
+    vColor = iColor;
+    vTexIndex = iTexIndex;
+}
+)";
+
+// 片段着色器（sampleSlot 由 setupShader 按可用纹理槽数生成）
+// GLSL 3.30 不允许以变量下标访问采样器数组，因此用 switch 展开
+static const char* SPRITE_FRAGMENT_SHADER_HEAD = R"(
 in vec2 vTexCoord;
 in vec4 vColor;
+flat in uint vTexIndex;
 
-uniform sampler2D uTexture;
+uniform sampler2D uTextures[MAX_TEXTURE_SLOTS];
 uniform int uUseSDF;
 uniform float uSdfOnEdge;
 uniform float uSdfScale;
 
 out vec4 fragColor;
+)";
 
+static const char* SPRITE_FRAGMENT_SHADER_MAIN = R"(
 void main() {
+    vec4 texel = sampleSlot(vTexCoord);
     if (uUseSDF == 1) {
-        float dist = texture(uTexture, vTexCoord).r;
-        float sd = (dist - uSdfOnEdge) * uSdfScale;
+        float sd = (texel.r - uSdfOnEdge) * uSdfScale;
         float w = fwidth(sd);
         float alpha = smoothstep(-w, w, sd);
         fragColor = vec4(vColor.rgb, vColor.a * alpha);
     } else {
-        fragColor = texture(uTexture, vTexCoord) * vColor;
+        fragColor = texel * vColor;
     }
 }
 )";
 
 GLSpriteBatch::GLSpriteBatch()
-    : vao_(0), vbo_(0), ibo_(0), currentTexture_(nullptr), currentIsSDF_(false), drawCallCount_(0), spriteCount_(0) {
-    vertices_.reserve(MAX_SPRITES * VERTICES_PER_SPRITE);
-    indices_.reserve(MAX_SPRITES * INDICES_PER_SPRITE);
+    : vao_(0), wideVao_(0), vbo_(0), ibo_(0)
+    , instanceVao_(0), cornerVbo_(0), instancing_(false)
+    , persistent_(false), mappedBase_(nullptr), writePtr_(nullptr)
+    , batchKind_(BatchKind::Quads), batchCount_(0), batchBytes_(0)
+    , segment_(0), segmentCursor_(0), fences_{}
+    , maxTextureSlots_(MAX_TEXTURE_SLOTS), slotCount_(0), slots_{}, currentIsSDF_(false)
+    , drawCallCount_(0), spriteCount_(0), batchBreakCount_(0) {
 }
 
 GLSpriteBatch::~GLSpriteBatch() {
@@ -62,7 +107,7 @@ GLSpriteBatch::~GLSpriteBatch() {
 
 bool GLSpriteBatch::init() {
     // 创建并编译着色器
-    if (!shader_.compileFromSource(SPRITE_VERTEX_SHADER, SPRITE_FRAGMENT_SHADER)) {
+    if (!setupShader()) {
         E2D_LOG_ERROR("Failed to compile sprite batch shader");
         return false;
     }
@@ -72,23 +117,20 @@ bool GLSpriteBatch::init() {
     glGenBuffers(1, &vbo_);
     glGenBuffers(1, &ibo_);
 
-    glBindVertexArray(vao_);
+    GLStateCache::instance().bindVertexArray(vao_);
 
-    // 设置 VBO
+    // 设置 VBO（流式顶点缓冲区）
     glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-    glBufferData(GL_ARRAY_BUFFER, MAX_SPRITES * VERTICES_PER_SPRITE * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
+    if (!initStreamBuffer()) {
+        E2D_LOG_ERROR("Failed to create sprite batch vertex stream");
+        GLStateCache::instance().bindVertexArray(0);
+        return false;
+    }
 
     // 设置顶点属性
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
-    
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
-    
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+    setupVertexAttributes();
 
-    // 生成索引缓冲区
+    // 生成索引缓冲区（索引相对于每次绘制的 baseVertex）
     std::vector<GLuint> indices;
     indices.reserve(MAX_SPRITES * INDICES_PER_SPRITE);
     for (size_t i = 0; i < MAX_SPRITES; ++i) {
@@ -104,16 +146,175 @@ bool GLSpriteBatch::init() {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
 
-    glBindVertexArray(0);
+    // float 纹理坐标的顶点路径：同一缓冲区，只是属性格式不同
+    glGenVertexArrays(1, &wideVao_);
+    GLStateCache::instance().bindVertexArray(wideVao_);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    setupWideVertexAttributes();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_);
+
+    GLStateCache::instance().bindVertexArray(0);
+
+    initInstanceArray();
 
     return true;
 }
 
+// ============================================================================
+// 实例化路径的 VAO：角点来自静态缓冲区，实例属性在每次绘制时指向流式缓冲区
+// ============================================================================
+void GLSpriteBatch::initInstanceArray() {
+    const glm::vec2 corners[4] = { {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f} };
+
+    glGenVertexArrays(1, &instanceVao_);
+    glGenBuffers(1, &cornerVbo_);
+
+    GLStateCache::instance().bindVertexArray(instanceVao_);
+    glBindBuffer(GL_ARRAY_BUFFER, cornerVbo_);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (void*)0);
+
+    // 与顶点路径共用索引缓冲区的第一个四边形
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_);
+
+    for (GLuint attrib = 1; attrib <= 7; ++attrib) {
+        glEnableVertexAttribArray(attrib);
+        glVertexAttribDivisor(attrib, 1);
+    }
+    bindInstanceAttributes(0);
+
+    GLStateCache::instance().bindVertexArray(0);
+}
+
+// GL 3.3 没有 baseInstance，批次起点通过属性指针偏移指定（需已绑定 instanceVao_）
+void GLSpriteBatch::bindInstanceAttributes(size_t byteOffset) {
+    auto offset = [byteOffset](size_t member) {
+        return reinterpret_cast<void*>(byteOffset + member);
+    };
+    const GLsizei stride = sizeof(Instance);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, offset(offsetof(Instance, position)));
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, offset(offsetof(Instance, size)));
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, stride, offset(offsetof(Instance, anchor)));
+    glVertexAttribPointer(4, 4, GL_UNSIGNED_SHORT, GL_TRUE, stride, offset(offsetof(Instance, texRect)));
+    glVertexAttribPointer(5, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, offset(offsetof(Instance, color)));
+    glVertexAttribPointer(6, 1, GL_FLOAT, GL_FALSE, stride, offset(offsetof(Instance, rotation)));
+    glVertexAttribIPointer(7, 1, GL_UNSIGNED_INT, stride, offset(offsetof(Instance, texIndex)));
+}
+
+// ============================================================================
+// 按可用纹理单元数生成并编译着色器
+// ============================================================================
+bool GLSpriteBatch::setupShader() {
+    GLint maxUnits = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxUnits);
+    maxTextureSlots_ = std::max(1u, std::min(MAX_TEXTURE_SLOTS, static_cast<uint32_t>(maxUnits)));
+
+    std::string sampleFunc = "vec4 sampleSlot(vec2 uv) {\n    switch (vTexIndex) {\n";
+    for (uint32_t i = 1; i < maxTextureSlots_; ++i) {
+        sampleFunc += "    case " + std::to_string(i) + "u: return texture(uTextures[" + std::to_string(i) + "], uv);\n";
+    }
+    sampleFunc += "    default: return texture(uTextures[0], uv);\n    }\n}\n";
+
+    std::string fragmentSource = "#version 330 core\n#define MAX_TEXTURE_SLOTS " + std::to_string(maxTextureSlots_) + "\n";
+    fragmentSource += SPRITE_FRAGMENT_SHADER_HEAD;
+    fragmentSource += sampleFunc;
+    fragmentSource += SPRITE_FRAGMENT_SHADER_MAIN;
+
+    if (!compileShader(shader_, SPRITE_VERTEX_SHADER, fragmentSource, uniforms_) ||
+        !compileShader(instanceShader_, SPRITE_INSTANCE_VERTEX_SHADER, fragmentSource, instanceUniforms_)) {
+        return false;
+    }
+
+    E2D_LOG_INFO("Sprite batch: {} texture slots per batch", maxTextureSlots_);
+    return true;
+}
+
+bool GLSpriteBatch::compileShader(GLShader& shader, const char* vertexSource,
+                                  const std::string& fragmentSource, ShaderUniforms& uniforms) {
+    if (!shader.compileFromSource(vertexSource, fragmentSource.c_str())) {
+        return false;
+    }
+
+    // 每批次都要设置的 uniform 预先解析位置
+    uniforms.viewProjection = shader.getUniformLocation("uViewProjection");
+    uniforms.useSDF = shader.getUniformLocation("uUseSDF");
+
+    // 采样器与纹理单元的对应关系、SDF 参数固定不变，只需设置一次
+    shader.bind();
+    for (uint32_t i = 0; i < maxTextureSlots_; ++i) {
+        shader.setInt("uTextures[" + std::to_string(i) + "]", static_cast<int>(i));
+    }
+    shader.setFloat("uSdfOnEdge", 128.0f / 255.0f);
+    shader.setFloat("uSdfScale", 255.0f / 64.0f);
+    shader.unbind();
+    return true;
+}
+
+// ============================================================================
+// 创建流式顶点缓冲区 - 优先使用持久映射，不支持时退化为缓冲区孤立
+// ============================================================================
+bool GLSpriteBatch::initStreamBuffer() {
+    if (GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage) {
+        const GLsizeiptr size = RING_SEGMENTS * SEGMENT_BYTES;
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+        mappedBase_ = static_cast<uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+        if (mappedBase_) {
+            persistent_ = true;
+            E2D_LOG_INFO("Sprite batch: persistent mapped ring buffer ({} segments)", RING_SEGMENTS);
+            return true;
+        }
+
+        // 不可变存储无法重新分配，换一个缓冲区对象走孤立路径
+        E2D_LOG_WARN("Sprite batch: persistent mapping failed, falling back to buffer orphaning");
+        glDeleteBuffers(1, &vbo_);
+        glGenBuffers(1, &vbo_);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    }
+
+    persistent_ = false;
+    glBufferData(GL_ARRAY_BUFFER, SEGMENT_BYTES, nullptr, GL_STREAM_DRAW);
+    return glGetError() == GL_NO_ERROR;
+}
+
 void GLSpriteBatch::shutdown() {
+    for (auto& fence : fences_) {
+        if (fence) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+    if (vbo_ != 0 && (mappedBase_ || writePtr_)) {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
+    mappedBase_ = nullptr;
+    writePtr_ = nullptr;
+    batchCount_ = 0;
+    batchBytes_ = 0;
+
     if (vao_ != 0) {
+        GLStateCache::instance().forgetVertexArray(vao_);
         glDeleteVertexArrays(1, &vao_);
         vao_ = 0;
     }
+    if (wideVao_ != 0) {
+        GLStateCache::instance().forgetVertexArray(wideVao_);
+        glDeleteVertexArrays(1, &wideVao_);
+        wideVao_ = 0;
+    }
+    if (instanceVao_ != 0) {
+        GLStateCache::instance().forgetVertexArray(instanceVao_);
+        glDeleteVertexArrays(1, &instanceVao_);
+        instanceVao_ = 0;
+    }
+    if (cornerVbo_ != 0) {
+        glDeleteBuffers(1, &cornerVbo_);
+        cornerVbo_ = 0;
+    }
     if (vbo_ != 0) {
         glDeleteBuffers(1, &vbo_);
         vbo_ = 0;
@@ -126,23 +327,164 @@ void GLSpriteBatch::shutdown() {
 
 void GLSpriteBatch::begin(const glm::mat4& viewProjection) {
     viewProjection_ = viewProjection;
-    vertices_.clear();
-    currentTexture_ = nullptr;
+    slotCount_ = 0;
     currentIsSDF_ = false;
     drawCallCount_ = 0;
     spriteCount_ = 0;
+    batchBreakCount_ = 0;
 }
 
-void GLSpriteBatch::draw(const Texture& texture, const SpriteData& data) {
-    // 如果纹理改变或缓冲区已满，先 flush
-    if (currentTexture_ != nullptr && (currentTexture_ != &texture || currentIsSDF_ != data.isSDF || vertices_.size() >= MAX_SPRITES * VERTICES_PER_SPRITE)) {
+// ============================================================================
+// 查找或分配纹理槽，槽已用尽时返回 MAX_TEXTURE_SLOTS
+// ============================================================================
+uint32_t GLSpriteBatch::acquireSlot(const Texture& texture) {
+    for (uint32_t i = 0; i < slotCount_; ++i) {
+        if (slots_[i] == &texture) {
+            return i;
+        }
+    }
+    if (slotCount_ < maxTextureSlots_) {
+        slots_[slotCount_] = &texture;
+        return slotCount_++;
+    }
+    return MAX_TEXTURE_SLOTS;
+}
+
+// ============================================================================
+// 为一个元素（4 个顶点或 1 条实例）预留空间，必要时打断批次；失败时返回 nullptr
+// ============================================================================
+// 每种批次元素的字节数与对齐（顶点批次通过 baseVertex 定位，起点须对齐到顶点大小）
+static size_t elementBytes(GLSpriteBatch::BatchKind kind) {
+    switch (kind) {
+    case GLSpriteBatch::BatchKind::WideQuads:
+        return sizeof(GLSpriteBatch::WideVertex) * GLSpriteBatch::VERTICES_PER_SPRITE;
+    case GLSpriteBatch::BatchKind::Instances:
+        return sizeof(GLSpriteBatch::Instance);
+    default:
+        return sizeof(GLSpriteBatch::Vertex) * GLSpriteBatch::VERTICES_PER_SPRITE;
+    }
+}
+
+static size_t elementAlignment(GLSpriteBatch::BatchKind kind) {
+    switch (kind) {
+    case GLSpriteBatch::BatchKind::WideQuads:
+        return sizeof(GLSpriteBatch::WideVertex);
+    case GLSpriteBatch::BatchKind::Instances:
+        return alignof(GLSpriteBatch::Instance);
+    default:
+        return sizeof(GLSpriteBatch::Vertex);
+    }
+}
+
+void* GLSpriteBatch::reserve(BatchKind kind, const Texture& texture, bool isSDF, uint32_t& slot) {
+    const size_t stride = elementBytes(kind);
+
+    // 元素类型或 SDF 状态改变、当前段剩余空间不足时打断批次
+    if (batchCount_ > 0) {
+        bool full = segmentCursor_ + batchBytes_ + stride > SEGMENT_BYTES;
+        if (batchKind_ != kind || currentIsSDF_ != isSDF || full) {
+            flush();
+            batchBreakCount_++;
+        }
+    }
+
+    // 纹理槽用尽时打断批次
+    slot = acquireSlot(texture);
+    if (slot == MAX_TEXTURE_SLOTS) {
         flush();
+        batchBreakCount_++;
+        slot = acquireSlot(texture);
+    }
+
+    if (batchCount_ == 0) {
+        size_t align = elementAlignment(kind);
+        segmentCursor_ = (segmentCursor_ + align - 1) / align * align;
+        if (segmentCursor_ + stride > SEGMENT_BYTES) {
+            advanceSegment();
+        }
+        batchKind_ = kind;
+    }
+    if (writePtr_ == nullptr) {
+        mapBatch();
+        if (writePtr_ == nullptr) return nullptr;
+    }
+
+    currentIsSDF_ = isSDF;
+
+    void* element = writePtr_ + batchBytes_;
+    batchBytes_ += stride;
+    batchCount_++;
+    spriteCount_++;
+    return element;
+}
+
+uint32_t GLSpriteBatch::packColor(const Color& color) {
+    auto channel = [](float value) {
+        return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+    // 按字节顺序写入，与字节序无关
+    const uint8_t bytes[4] = { channel(color.r), channel(color.g), channel(color.b), channel(color.a) };
+    uint32_t packed;
+    std::memcpy(&packed, bytes, sizeof(packed));
+    return packed;
+}
+
+static inline uint16_t packTexCoord(float value) {
+    return static_cast<uint16_t>(std::clamp(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+bool GLSpriteBatch::fitsPackedTexCoords(const SpriteData& data) {
+    return data.texCoordMin.x >= 0.0f && data.texCoordMin.y >= 0.0f &&
+           data.texCoordMax.x <= 1.0f && data.texCoordMax.y <= 1.0f;
+}
+
+void GLSpriteBatch::draw(const Texture& texture, const SpriteData& data) {
+    // 超出 [0,1] 的纹理坐标（重复环绕平铺）不能截断为 unorm16，改走 float 顶点
+    if (!fitsPackedTexCoords(data)) {
+        drawWideVertices(texture, data);
+    } else if (instancing_) {
+        drawInstance(texture, data);
+    } else {
+        drawVertices(texture, data);
     }
+}
+
+void GLSpriteBatch::drawInstance(const Texture& texture, const SpriteData& data) {
+    uint32_t slot = 0;
+    auto* instance = static_cast<Instance*>(reserve(BatchKind::Instances, texture, data.isSDF, slot));
+    if (instance == nullptr) return;
+
+    *instance = Instance{
+        data.position,
+        data.size,
+        data.anchor,
+        { packTexCoord(data.texCoordMin.x), packTexCoord(data.texCoordMin.y),
+          packTexCoord(data.texCoordMax.x), packTexCoord(data.texCoordMax.y) },
+        data.color,
+        data.rotation,
+        slot
+    };
+}
 
-    currentTexture_ = &texture;
-    currentIsSDF_ = data.isSDF;
+void GLSpriteBatch::drawVertices(const Texture& texture, const SpriteData& data) {
+    uint32_t slot = 0;
+    auto* v = static_cast<Vertex*>(reserve(BatchKind::Quads, texture, data.isSDF, slot));
+    if (v == nullptr) return;
+
+    // 直接写入映射内存
+    buildQuad(data, slot, v);
+}
+
+void GLSpriteBatch::drawWideVertices(const Texture& texture, const SpriteData& data) {
+    uint32_t slot = 0;
+    auto* v = static_cast<WideVertex*>(reserve(BatchKind::WideQuads, texture, data.isSDF, slot));
+    if (v == nullptr) return;
+
+    buildQuad(data, slot, v);
+}
 
-    // 计算变换后的顶点位置
+// 四个角的位置，顺序为左上、右上、右下、左下
+static void quadCorners(const GLSpriteBatch::SpriteData& data, glm::vec2* corners) {
     glm::vec2 anchorOffset(data.size.x * data.anchor.x, data.size.y * data.anchor.y);
     
     float cosR = cosf(data.rotation);
@@ -157,58 +499,274 @@ void GLSpriteBatch::draw(const Texture& texture, const SpriteData& data) {
         );
     };
 
-    glm::vec4 color(data.color.r, data.color.g, data.color.b, data.color.a);
+    corners[0] = transform(0, 0);
+    corners[1] = transform(data.size.x, 0);
+    corners[2] = transform(data.size.x, data.size.y);
+    corners[3] = transform(0, data.size.y);
+}
+
+void GLSpriteBatch::buildQuad(const SpriteData& data, uint32_t slot, Vertex* v) {
+    glm::vec2 corners[VERTICES_PER_SPRITE];
+    quadCorners(data, corners);
+
+    const uint32_t color = data.color;
+    const uint16_t u0 = packTexCoord(data.texCoordMin.x);
+    const uint16_t v0 = packTexCoord(data.texCoordMin.y);
+    const uint16_t u1 = packTexCoord(data.texCoordMax.x);
+    const uint16_t v1 = packTexCoord(data.texCoordMax.y);
 
-    // 添加四个顶点（图片已在加载时翻转，纹理坐标直接使用）
+    // 图片已在加载时翻转，纹理坐标直接使用
     // v0(左上) -- v1(右上)
     //   |           |
     // v3(左下) -- v2(右下)
-    Vertex v0{ transform(0, 0), glm::vec2(data.texCoordMin.x, data.texCoordMin.y), color };
-    Vertex v1{ transform(data.size.x, 0), glm::vec2(data.texCoordMax.x, data.texCoordMin.y), color };
-    Vertex v2{ transform(data.size.x, data.size.y), glm::vec2(data.texCoordMax.x, data.texCoordMax.y), color };
-    Vertex v3{ transform(0, data.size.y), glm::vec2(data.texCoordMin.x, data.texCoordMax.y), color };
+    v[0] = Vertex{ corners[0], { u0, v0 }, color, slot };
+    v[1] = Vertex{ corners[1], { u1, v0 }, color, slot };
+    v[2] = Vertex{ corners[2], { u1, v1 }, color, slot };
+    v[3] = Vertex{ corners[3], { u0, v1 }, color, slot };
+}
 
-    vertices_.push_back(v0);
-    vertices_.push_back(v1);
-    vertices_.push_back(v2);
-    vertices_.push_back(v3);
+void GLSpriteBatch::buildQuad(const SpriteData& data, uint32_t slot, WideVertex* v) {
+    glm::vec2 corners[VERTICES_PER_SPRITE];
+    quadCorners(data, corners);
+
+    const uint32_t color = data.color;
+    const glm::vec2& uvMin = data.texCoordMin;
+    const glm::vec2& uvMax = data.texCoordMax;
+    v[0] = WideVertex{ corners[0], { uvMin.x, uvMin.y }, color, slot };
+    v[1] = WideVertex{ corners[1], { uvMax.x, uvMin.y }, color, slot };
+    v[2] = WideVertex{ corners[2], { uvMax.x, uvMax.y }, color, slot };
+    v[3] = WideVertex{ corners[3], { uvMin.x, uvMax.y }, color, slot };
+}
 
-    spriteCount_++;
+GLSpriteBatch::SpriteData GLSpriteBatch::makeSpriteData(const Texture& texture, const Rect& destRect,
+                                                        const Rect& srcRect, const Color& tint,
+                                                        float rotation, const Vec2& anchor) {
+    SpriteData data;
+    data.position = glm::vec2(destRect.origin.x, destRect.origin.y);
+    data.size = glm::vec2(destRect.size.width, destRect.size.height);
+    
+    float texW = static_cast<float>(texture.getWidth());
+    float texH = static_cast<float>(texture.getHeight());
+    
+    // 纹理坐标计算
+    // OpenGL纹理坐标系：原点在左下角，V向上增加
+    // 图片数据：原点在左上角，Y向下增加
+    // 因此需要翻转V坐标：v' = 1 - v
+    float u1 = srcRect.origin.x / texW;
+    float u2 = (srcRect.origin.x + srcRect.size.width) / texW;
+    // 翻转V坐标
+    float v1 = 1.0f - (srcRect.origin.y / texH);
+    float v2 = 1.0f - ((srcRect.origin.y + srcRect.size.height) / texH);
+    
+    data.texCoordMin = glm::vec2(std::min(u1, u2), std::min(v1, v2));
+    data.texCoordMax = glm::vec2(std::max(u1, u2), std::max(v1, v2));
+    
+    data.color = packColor(tint);
+    data.rotation = rotation * 3.14159f / 180.0f;
+    data.anchor = glm::vec2(anchor.x, anchor.y);
+    data.isSDF = false;
+    return data;
+}
+
+// 为当前绑定的 VAO / 顶点缓冲区设置 Vertex 格式的属性
+void GLSpriteBatch::setupVertexAttributes() {
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+    
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, texCoord));
+    
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+
+    glEnableVertexAttribArray(3);
+    glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(Vertex), (void*)offsetof(Vertex, texIndex));
+}
+
+// 为当前绑定的 VAO / 顶点缓冲区设置 WideVertex 格式的属性（位置与 Vertex 路径相同）
+void GLSpriteBatch::setupWideVertexAttributes() {
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(WideVertex), (void*)offsetof(WideVertex, position));
+
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(WideVertex), (void*)offsetof(WideVertex, texCoord));
+
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(WideVertex), (void*)offsetof(WideVertex, color));
+
+    glEnableVertexAttribArray(3);
+    glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(WideVertex), (void*)offsetof(WideVertex, texIndex));
+}
+
+void GLSpriteBatch::drawQuad(const Texture& texture, const glm::vec2* positions,
+                             const glm::vec2& texCoord, uint32_t color) {
+    uint32_t slot = 0;
+    auto* v = static_cast<Vertex*>(reserve(BatchKind::Quads, texture, false, slot));
+    if (v == nullptr) return;
+
+    const uint16_t u = packTexCoord(texCoord.x);
+    const uint16_t t = packTexCoord(texCoord.y);
+    for (size_t i = 0; i < VERTICES_PER_SPRITE; ++i) {
+        v[i] = Vertex{ positions[i], { u, t }, color, slot };
+    }
+}
+
+void GLSpriteBatch::setViewProjection(const glm::mat4& viewProjection) {
+    if (viewProjection == viewProjection_) return;
+    end();
+    viewProjection_ = viewProjection;
+}
+
+// ============================================================================
+// 绘制静态精灵缓冲区：提交当前批次后，每种纹理一次绘制调用
+// 模型变换并入视图投影矩阵，节点移动时无需重建顶点
+// ============================================================================
+void GLSpriteBatch::drawStatic(const GLStaticSpriteBuffer& buffer, const glm::mat4& transform) {
+    if (buffer.getSpriteCount() == 0) return;
+    end();
+
+    GLStateCache& state = GLStateCache::instance();
+    shader_.bind();
+    shader_.setMat4(uniforms_.viewProjection, viewProjection_ * transform);
+    shader_.setInt(uniforms_.useSDF, 0);
+    state.bindVertexArray(buffer.getVertexArray());
+
+    // 静态顶点的纹理槽索引均为 0
+    for (const auto& range : buffer.getRanges()) {
+        GLuint texID = static_cast<GLuint>(reinterpret_cast<uintptr_t>(range.texture->getNativeHandle()));
+        state.bindTexture(0, texID);
+        glDrawElements(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT,
+                       reinterpret_cast<void*>(range.indexOffset * sizeof(GLuint)));
+        drawCallCount_++;
+    }
+    spriteCount_ += static_cast<uint32_t>(buffer.getSpriteCount());
+}
+
+void GLSpriteBatch::setInstancingEnabled(bool enabled) {
+    if (instancing_ == enabled) return;
+    end();
+    instancing_ = enabled;
 }
 
 void GLSpriteBatch::end() {
-    if (!vertices_.empty()) {
+    if (batchCount_ > 0) {
         flush();
     }
 }
 
+void GLSpriteBatch::endFrame() {
+    end();
+    if (persistent_ && segmentCursor_ > 0) {
+        advanceSegment();
+    }
+}
+
+// ============================================================================
+// 为下一批次准备映射内存
+// ============================================================================
+void GLSpriteBatch::mapBatch() {
+    if (persistent_) {
+        writePtr_ = mappedBase_ + segment_ * SEGMENT_BYTES + segmentCursor_;
+        return;
+    }
+
+    // 孤立模式：只映射尚未使用的尾部，非同步写入不会覆盖 GPU 正在读取的区域
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    writePtr_ = static_cast<uint8_t*>(glMapBufferRange(
+        GL_ARRAY_BUFFER,
+        segmentCursor_,
+        SEGMENT_BYTES - segmentCursor_,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT));
+    if (!writePtr_) {
+        E2D_LOG_ERROR("Sprite batch: failed to map vertex buffer");
+    }
+}
+
+// ============================================================================
+// 切换到下一段缓冲区
+// 持久映射：为当前段插入栅栏，等待下一段上一轮的绘制完成
+// 孤立模式：重新分配缓冲区存储，驱动负责保留旧数据直到 GPU 使用完毕
+// ============================================================================
+void GLSpriteBatch::advanceSegment() {
+    if (!persistent_) {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+        glBufferData(GL_ARRAY_BUFFER, SEGMENT_BYTES, nullptr, GL_STREAM_DRAW);
+        segmentCursor_ = 0;
+        return;
+    }
+
+    fences_[segment_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    segment_ = (segment_ + 1) % RING_SEGMENTS;
+    segmentCursor_ = 0;
+
+    GLsync fence = fences_[segment_];
+    if (fence) {
+        GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (true) {
+            GLenum result = glClientWaitSync(fence, waitFlags, 1000000);
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED) {
+                break;
+            }
+            waitFlags = 0;
+        }
+        glDeleteSync(fence);
+        fences_[segment_] = nullptr;
+    }
+}
+
 void GLSpriteBatch::flush() {
-    if (vertices_.empty() || currentTexture_ == nullptr) return;
+    if (batchCount_ == 0 || slotCount_ == 0) {
+        slotCount_ = 0;
+        return;
+    }
 
-    // 绑定纹理
-    GLuint texID = static_cast<GLuint>(reinterpret_cast<uintptr_t>(currentTexture_->getNativeHandle()));
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, texID);
+    size_t byteOffset = segmentCursor_;
+    if (persistent_) {
+        byteOffset += segment_ * SEGMENT_BYTES;
+    } else {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+        glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, batchBytes_);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    }
 
-    // 使用着色器
-    shader_.bind();
-    shader_.setMat4("uViewProjection", viewProjection_);
-    shader_.setInt("uTexture", 0);
-    shader_.setInt("uUseSDF", currentIsSDF_ ? 1 : 0);
-    shader_.setFloat("uSdfOnEdge", 128.0f / 255.0f);
-    shader_.setFloat("uSdfScale", 255.0f / 64.0f);
+    // 本批次可能引用新光栅化的字形，先把字体图集的脏区域上传
+    GLFontAtlas::flushUploads();
 
-    // 更新 VBO 数据
-    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, vertices_.size() * sizeof(Vertex), vertices_.data());
+    // 绑定本批次用到的所有纹理槽（已绑定在同一单元上的纹理由状态缓存跳过）
+    GLStateCache& state = GLStateCache::instance();
+    for (uint32_t i = 0; i < slotCount_; ++i) {
+        GLuint texID = static_cast<GLuint>(reinterpret_cast<uintptr_t>(slots_[i]->getNativeHandle()));
+        state.bindTexture(i, texID);
+    }
 
-    // 绘制
-    glBindVertexArray(vao_);
-    GLsizei indexCount = static_cast<GLsizei>(vertices_.size() / VERTICES_PER_SPRITE * INDICES_PER_SPRITE);
-    glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+    // 使用着色器（未变化的 uniform 不会重新上传）
+    bool instanced = batchKind_ == BatchKind::Instances;
+    GLShader& shader = instanced ? instanceShader_ : shader_;
+    const ShaderUniforms& uniforms = instanced ? instanceUniforms_ : uniforms_;
+    shader.bind();
+    shader.setMat4(uniforms.viewProjection, viewProjection_);
+    shader.setInt(uniforms.useSDF, currentIsSDF_ ? 1 : 0);
+
+    // 绘制（数据已在映射内存中，无需再上传）
+    if (batchKind_ == BatchKind::Instances) {
+        GLStateCache::instance().bindVertexArray(instanceVao_);
+        bindInstanceAttributes(byteOffset);
+        glDrawElementsInstanced(GL_TRIANGLES, INDICES_PER_SPRITE, GL_UNSIGNED_INT, nullptr,
+                                static_cast<GLsizei>(batchCount_));
+    } else {
+        bool wide = batchKind_ == BatchKind::WideQuads;
+        GLStateCache::instance().bindVertexArray(wide ? wideVao_ : vao_);
+        GLsizei indexCount = static_cast<GLsizei>(batchCount_ * INDICES_PER_SPRITE);
+        GLint baseVertex = static_cast<GLint>(byteOffset / (wide ? sizeof(WideVertex) : sizeof(Vertex)));
+        glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr, baseVertex);
+    }
 
     drawCallCount_++;
-    vertices_.clear();
+    segmentCursor_ += batchBytes_;
+    batchCount_ = 0;
+    batchBytes_ = 0;
+    writePtr_ = nullptr;
+    slotCount_ = 0;
 }
 
 } // namespace easy2d
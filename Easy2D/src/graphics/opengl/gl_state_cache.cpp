@@ -0,0 +1,116 @@
+#include <easy2d/graphics/opengl/gl_state_cache.h>
+
+namespace easy2d {
+
+GLStateCache& GLStateCache::instance() {
+    static GLStateCache cache;
+    return cache;
+}
+
+GLStateCache::GLStateCache()
+    : shaderBinds_(0), textureBinds_(0) {
+    invalidate();
+}
+
+bool GLStateCache::useProgram(GLuint program) {
+    if (program_ == program) return false;
+    glUseProgram(program);
+    program_ = program;
+    shaderBinds_++;
+    return true;
+}
+
+bool GLStateCache::bindVertexArray(GLuint vao) {
+    if (vertexArray_ == vao) return false;
+    glBindVertexArray(vao);
+    vertexArray_ = vao;
+    return true;
+}
+
+bool GLStateCache::bindTexture(uint32_t unit, GLuint texture) {
+    if (unit < MAX_TEXTURE_UNITS && textures_[unit] == texture) return false;
+    if (activeUnit_ != unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        activeUnit_ = unit;
+    }
+    glBindTexture(GL_TEXTURE_2D, texture);
+    if (unit < MAX_TEXTURE_UNITS) {
+        textures_[unit] = texture;
+    }
+    textureBinds_++;
+    return true;
+}
+
+void GLStateCache::bindTextureForUpload(GLuint texture) {
+    // glTexImage 等调用作用于活动单元，因此即使纹理已绑定在单元 0 也要确保单元 0 处于活动状态
+    if (activeUnit_ != 0) {
+        glActiveTexture(GL_TEXTURE0);
+        activeUnit_ = 0;
+    }
+    bindTexture(0, texture);
+}
+
+void GLStateCache::setBlend(bool enabled, GLenum srcFactor, GLenum dstFactor) {
+    setBlend(enabled, srcFactor, dstFactor, srcFactor, dstFactor);
+}
+
+void GLStateCache::setBlend(bool enabled, GLenum srcFactor, GLenum dstFactor, GLenum srcAlpha, GLenum dstAlpha) {
+    if (blendEnabled_ != (enabled ? 1 : 0)) {
+        if (enabled) {
+            glEnable(GL_BLEND);
+        } else {
+            glDisable(GL_BLEND);
+        }
+        blendEnabled_ = enabled ? 1 : 0;
+    }
+    // 关闭混合时保留之前的混合函数，重新开启时按需设置
+    if (enabled && (blendSrc_ != srcFactor || blendDst_ != dstFactor ||
+                    blendSrcAlpha_ != srcAlpha || blendDstAlpha_ != dstAlpha)) {
+        glBlendFuncSeparate(srcFactor, dstFactor, srcAlpha, dstAlpha);
+        blendSrc_ = srcFactor;
+        blendDst_ = dstFactor;
+        blendSrcAlpha_ = srcAlpha;
+        blendDstAlpha_ = dstAlpha;
+    }
+}
+
+void GLStateCache::forgetProgram(GLuint program) {
+    if (program_ == program) {
+        program_ = UNKNOWN;
+    }
+}
+
+void GLStateCache::forgetVertexArray(GLuint vao) {
+    if (vertexArray_ == vao) {
+        vertexArray_ = UNKNOWN;
+    }
+}
+
+void GLStateCache::forgetTexture(GLuint texture) {
+    for (auto& bound : textures_) {
+        if (bound == texture) {
+            bound = UNKNOWN;
+        }
+    }
+}
+
+void GLStateCache::invalidate() {
+    program_ = UNKNOWN;
+    vertexArray_ = UNKNOWN;
+    activeUnit_ = UNKNOWN;
+    for (auto& bound : textures_) {
+        bound = UNKNOWN;
+    }
+    blendEnabled_ = -1;
+    blendSrc_ = GL_NONE;
+    blendDst_ = GL_NONE;
+    blendSrcAlpha_ = GL_NONE;
+    blendDstAlpha_ = GL_NONE;
+}
+
+void GLStateCache::resetCounters() {
+    shaderBinds_ = 0;
+    textureBinds_ = 0;
+}
+
+} // namespace easy2d
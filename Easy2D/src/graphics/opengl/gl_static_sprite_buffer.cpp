@@ -0,0 +1,127 @@
+#include <easy2d/graphics/opengl/gl_static_sprite_buffer.h>
+#include <easy2d/graphics/opengl/gl_state_cache.h>
+#include <easy2d/graphics/texture.h>
+#include <unordered_map>
+
+namespace easy2d {
+
+GLStaticSpriteBuffer::GLStaticSpriteBuffer()
+    : vao_(0), vbo_(0), ibo_(0), spriteCount_(0), indexCapacity_(0), wide_(false) {
+}
+
+GLStaticSpriteBuffer::~GLStaticSpriteBuffer() {
+    if (vao_ != 0) {
+        GLStateCache::instance().forgetVertexArray(vao_);
+        glDeleteVertexArrays(1, &vao_);
+    }
+    if (vbo_ != 0) {
+        glDeleteBuffers(1, &vbo_);
+    }
+    if (ibo_ != 0) {
+        glDeleteBuffers(1, &ibo_);
+    }
+}
+
+void GLStaticSpriteBuffer::createObjects() {
+    glGenVertexArrays(1, &vao_);
+    glGenBuffers(1, &vbo_);
+    glGenBuffers(1, &ibo_);
+
+    GLStateCache::instance().bindVertexArray(vao_);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    GLSpriteBatch::setupVertexAttributes();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_);
+}
+
+// 按顶点格式生成四边形并上传（需已绑定 vbo_），CPU 副本随即释放
+template <typename VertexType>
+void GLStaticSpriteBuffer::uploadVertices(const std::vector<GLSpriteBatch::SpriteData>& quads) {
+    std::vector<VertexType> vertices(quads.size() * GLSpriteBatch::VERTICES_PER_SPRITE);
+    for (size_t i = 0; i < quads.size(); ++i) {
+        GLSpriteBatch::buildQuad(quads[i], 0, &vertices[i * GLSpriteBatch::VERTICES_PER_SPRITE]);
+    }
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(VertexType), vertices.data(), GL_STATIC_DRAW);
+}
+
+// ============================================================================
+// 重建缓冲区 - 按纹理做计数排序，同一纹理的精灵连续存放
+// ============================================================================
+void GLStaticSpriteBuffer::build(const std::vector<StaticSprite>& sprites) {
+    if (vao_ == 0) {
+        createObjects();
+    }
+
+    // 按纹理首次出现的顺序分组（图集区域按所在的页纹理分组）
+    ranges_.clear();
+    std::unordered_map<const Texture*, size_t> groupOf;
+    std::vector<size_t> groupCounts;
+    for (const auto& sprite : sprites) {
+        if (!sprite.texture || !sprite.texture->isValid()) continue;
+        const Texture* source = &sprite.texture->getSourceTexture();
+        auto result = groupOf.emplace(source, ranges_.size());
+        if (result.second) {
+            ranges_.push_back(Range{ source, 0, 0 });
+            groupCounts.push_back(0);
+        }
+        groupCounts[result.first->second]++;
+    }
+
+    size_t offset = 0;
+    for (size_t i = 0; i < ranges_.size(); ++i) {
+        ranges_[i].indexOffset = static_cast<GLsizei>(offset * GLSpriteBatch::INDICES_PER_SPRITE);
+        ranges_[i].indexCount = static_cast<GLsizei>(groupCounts[i] * GLSpriteBatch::INDICES_PER_SPRITE);
+        groupCounts[i] = offset;
+        offset += ranges_[i].indexCount / GLSpriteBatch::INDICES_PER_SPRITE;
+    }
+    spriteCount_ = offset;
+
+    // 精灵数据按分组后的位置存放；任一精灵的纹理坐标超出 [0,1] 时整体使用 float 纹理坐标
+    std::vector<GLSpriteBatch::SpriteData> quads(spriteCount_);
+    bool wide = false;
+    for (const auto& sprite : sprites) {
+        if (!sprite.texture || !sprite.texture->isValid()) continue;
+        const Texture& source = sprite.texture->getSourceTexture();
+        Rect srcRect = sprite.srcRect;
+        srcRect.origin += sprite.texture->getSourceOffset();
+
+        size_t slot = groupCounts[groupOf[&source]]++;
+        quads[slot] = GLSpriteBatch::makeSpriteData(source, sprite.destRect, srcRect,
+                                                    sprite.tint, sprite.rotation, sprite.anchor);
+        wide = wide || !GLSpriteBatch::fitsPackedTexCoords(quads[slot]);
+    }
+
+    GLStateCache::instance().bindVertexArray(vao_);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    if (wide != wide_) {
+        wide_ = wide;
+        if (wide) {
+            GLSpriteBatch::setupWideVertexAttributes();
+        } else {
+            GLSpriteBatch::setupVertexAttributes();
+        }
+    }
+    if (wide) {
+        uploadVertices<GLSpriteBatch::WideVertex>(quads);
+    } else {
+        uploadVertices<GLSpriteBatch::Vertex>(quads);
+    }
+
+    // 索引只与四边形数量有关，容量不足时才重新生成
+    if (spriteCount_ > indexCapacity_) {
+        std::vector<GLuint> indices;
+        indices.reserve(spriteCount_ * GLSpriteBatch::INDICES_PER_SPRITE);
+        for (size_t i = 0; i < spriteCount_; ++i) {
+            GLuint base = static_cast<GLuint>(i * GLSpriteBatch::VERTICES_PER_SPRITE);
+            indices.push_back(base + 0);
+            indices.push_back(base + 1);
+            indices.push_back(base + 2);
+            indices.push_back(base + 0);
+            indices.push_back(base + 2);
+            indices.push_back(base + 3);
+        }
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+        indexCapacity_ = spriteCount_;
+    }
+}
+
+} // namespace easy2d
@@ -1,111 +1,179 @@
 #include <easy2d/graphics/opengl/gl_texture.h>
+#include <easy2d/graphics/opengl/gl_state_cache.h>
+#include <easy2d/graphics/opengl/gl_texture_uploader.h>
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb/stb_image.h>
 #include <easy2d/utils/logger.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 
 namespace easy2d {
 
-GLTexture::GLTexture(int width, int height, const uint8_t* pixels, int channels)
-    : textureID_(0), width_(width), height_(height), channels_(channels) {
-    // 保存像素数据用于生成遮罩
-    if (pixels) {
-        pixelData_.resize(width * height * channels);
-        std::memcpy(pixelData_.data(), pixels, pixelData_.size());
-    }
+std::atomic<size_t> GLTexture::totalGpuBytes_{ 0 };
+
+GLTexture::GLTexture(int width, int height, const uint8_t* pixels, int channels,
+                     const TextureLoadOptions& options)
+    : textureID_(0), width_(width), height_(height), channels_(channels)
+    , mipmaps_(options.mipmaps), gpuBytes_(0), pixels_(nullptr, std::free) {
     createTexture(pixels);
+    retainPixels(pixels, PixelBuffer(nullptr, std::free), options);
 }
 
-GLTexture::GLTexture(const std::string& filepath)
-    : textureID_(0), width_(0), height_(0), channels_(0) {
+GLTexture::GLTexture(int width, int height, PixelBuffer pixels, int channels,
+                     const TextureLoadOptions& options)
+    : textureID_(0), width_(width), height_(height), channels_(channels)
+    , mipmaps_(options.mipmaps), gpuBytes_(0), pixels_(nullptr, std::free) {
+    const uint8_t* data = pixels.get();
+    createTexture(data);
+    retainPixels(data, std::move(pixels), options);
+}
+
+GLTexture::GLTexture(const std::string& filepath, const TextureLoadOptions& options)
+    : textureID_(0), width_(0), height_(0), channels_(0)
+    , mipmaps_(options.mipmaps), gpuBytes_(0), pixels_(nullptr, std::free) {
     // 不翻转图片，保持原始方向
     // OpenGL纹理坐标原点在左下角，图片数据原点在左上角
     // 在渲染时通过纹理坐标翻转来处理
     stbi_set_flip_vertically_on_load(false);
-    uint8_t* data = stbi_load(filepath.c_str(), &width_, &height_, &channels_, 0);
+    PixelBuffer data(stbi_load(filepath.c_str(), &width_, &height_, &channels_, 0), stbi_image_free);
     if (data) {
-        // 保存像素数据用于生成遮罩
-        pixelData_.resize(width_ * height_ * channels_);
-        std::memcpy(pixelData_.data(), data, pixelData_.size());
-        
-        createTexture(data);
-        stbi_image_free(data);
+        createTexture(data.get());
+        // 需要保留像素时直接接管 stb_image 的缓冲区，不再复制
+        const uint8_t* pixels = data.get();
+        retainPixels(pixels, std::move(data), options);
     } else {
         E2D_LOG_ERROR("Failed to load texture: {}", filepath);
     }
 }
 
+// ============================================================================
+// 按加载选项保留 CPU 端数据 - owned 非空时为可直接接管的缓冲区
+// ============================================================================
+void GLTexture::retainPixels(const uint8_t* pixels, PixelBuffer owned, const TextureLoadOptions& options) {
+    if (!pixels) {
+        return;
+    }
+
+    if (options.keepAlphaMask) {
+        alphaMask_ = std::make_unique<AlphaMask>(
+            AlphaMask::createFromPixels(pixels, width_, height_, channels_));
+    }
+
+    if (options.keepPixels) {
+        if (!owned) {
+            size_t size = static_cast<size_t>(width_) * height_ * channels_;
+            owned.reset(static_cast<uint8_t*>(std::malloc(size)));
+            if (owned) {
+                std::memcpy(owned.get(), pixels, size);
+            }
+        }
+        pixels_ = std::move(owned);
+    }
+}
+
 GLTexture::~GLTexture() {
+    totalGpuBytes_.fetch_sub(gpuBytes_, std::memory_order_relaxed);
     if (textureID_ != 0) {
+        GLStateCache::instance().forgetTexture(textureID_);
         glDeleteTextures(1, &textureID_);
     }
 }
 
+size_t GLTexture::getMemoryUsage() const {
+    size_t bytes = gpuBytes_;
+    if (pixels_) {
+        bytes += static_cast<size_t>(width_) * height_ * channels_;
+    }
+    if (alphaMask_) {
+        bytes += alphaMask_->getMemoryUsage();
+    }
+    return bytes;
+}
+
 void GLTexture::setFilter(bool linear) {
-    bind();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, linear ? GL_LINEAR : GL_NEAREST);
+    GLenum minFilter = linear ? GL_LINEAR : GL_NEAREST;
+    if (mipmaps_) {
+        minFilter = linear ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+    }
+    GLStateCache::instance().bindTextureForUpload(textureID_);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, minFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, linear ? GL_LINEAR : GL_NEAREST);
 }
 
 void GLTexture::setWrap(bool repeat) {
-    bind();
+    GLStateCache::instance().bindTextureForUpload(textureID_);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE);
 }
 
+void GLTexture::setCoverageSwizzle() {
+    const GLint swizzle[4] = { GL_ONE, GL_ONE, GL_ONE, GL_RED };
+    GLStateCache::instance().bindTextureForUpload(textureID_);
+    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+}
+
 void GLTexture::bind(unsigned int slot) const {
-    glActiveTexture(GL_TEXTURE0 + slot);
-    glBindTexture(GL_TEXTURE_2D, textureID_);
+    GLStateCache::instance().bindTexture(slot, textureID_);
 }
 
 void GLTexture::unbind() const {
-    glBindTexture(GL_TEXTURE_2D, 0);
+    GLStateCache::instance().bindTexture(0, 0);
 }
 
 void GLTexture::createTexture(const uint8_t* pixels) {
     GLenum format = GL_RGBA;
     GLenum internalFormat = GL_RGBA8;
-    int unpackAlignment = 4;
     if (channels_ == 1) {
         format = GL_RED;
         internalFormat = GL_R8;
-        unpackAlignment = 1;
     } else if (channels_ == 3) {
         format = GL_RGB;
         internalFormat = GL_RGB8;
-        unpackAlignment = 1;
     } else if (channels_ == 4) {
         format = GL_RGBA;
         internalFormat = GL_RGBA8;
-        unpackAlignment = 4;
     }
 
     glGenTextures(1, &textureID_);
-    bind();
-    
-    GLint prevUnpackAlignment = 4;
-    glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevUnpackAlignment);
-    glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment);
+    GLStateCache::instance().bindTextureForUpload(textureID_);
 
-    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width_, height_, 0, format, GL_UNSIGNED_BYTE, pixels);
-    glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpackAlignment);
+    // 先分配存储，像素经 PBO 上传，不阻塞在客户端内存拷贝上
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width_, height_, 0, format, GL_UNSIGNED_BYTE, nullptr);
+    if (pixels) {
+        GLTextureUploader::instance().upload(textureID_, 0, 0, width_, height_, format, pixels);
+    }
     
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     // 使用 NEAREST 过滤器，更适合像素艺术风格的精灵
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mipmaps_ ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     
-    glGenerateMipmap(GL_TEXTURE_2D);
+    // 统计显存占用（含 mipmap 链）
+    size_t levelWidth = static_cast<size_t>(width_);
+    size_t levelHeight = static_cast<size_t>(height_);
+    size_t bytesPerPixel = static_cast<size_t>(channels_ == 1 ? 1 : channels_ == 3 ? 3 : 4);
+    gpuBytes_ = levelWidth * levelHeight * bytesPerPixel;
+    if (mipmaps_) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+        while (levelWidth > 1 || levelHeight > 1) {
+            levelWidth = std::max<size_t>(levelWidth / 2, 1);
+            levelHeight = std::max<size_t>(levelHeight / 2, 1);
+            gpuBytes_ += levelWidth * levelHeight * bytesPerPixel;
+        }
+    }
+    totalGpuBytes_.fetch_add(gpuBytes_, std::memory_order_relaxed);
 }
 
 void GLTexture::generateAlphaMask() {
-    if (pixelData_.empty() || width_ <= 0 || height_ <= 0) {
-        E2D_LOG_WARN("Cannot generate alpha mask: no pixel data available");
+    if (!pixels_ || width_ <= 0 || height_ <= 0) {
+        E2D_LOG_WARN("Cannot generate alpha mask: pixels were not kept (load with keepPixels or keepAlphaMask)");
         return;
     }
     
     alphaMask_ = std::make_unique<AlphaMask>(
-        AlphaMask::createFromPixels(pixelData_.data(), width_, height_, channels_)
+        AlphaMask::createFromPixels(pixels_.get(), width_, height_, channels_)
     );
     
     E2D_LOG_DEBUG("Generated alpha mask for texture: {}x{}", width_, height_);
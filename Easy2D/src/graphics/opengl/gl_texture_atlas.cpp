@@ -0,0 +1,118 @@
+#include <easy2d/graphics/opengl/gl_texture_atlas.h>
+#include <easy2d/graphics/opengl/gl_texture_uploader.h>
+#include <easy2d/utils/logger.h>
+#include <algorithm>
+#include <cstring>
+
+namespace easy2d {
+
+GLTextureAtlas::GLTextureAtlas(int pageSize)
+    : pageSize_(pageSize) {
+}
+
+GLTextureAtlas::Page& GLTextureAtlas::createPage() {
+    auto page = std::make_unique<Page>();
+    // 不把像素交给 GLTexture，避免它在内存中保留整页的副本；改为直接在 PBO 中清零上传
+    page->texture = makePtr<GLTexture>(pageSize_, pageSize_, nullptr, 4);
+    size_t pageBytes = static_cast<size_t>(pageSize_) * pageSize_ * 4;
+    GLTextureUploader::instance().upload(page->texture->getTextureID(), 0, 0, pageSize_, pageSize_, GL_RGBA,
+                                         [pageBytes](uint8_t* dst) { std::memset(dst, 0, pageBytes); });
+
+    page->nodes.resize(pageSize_);
+    stbrp_init_target(&page->context, pageSize_, pageSize_, page->nodes.data(), pageSize_);
+
+    pages_.push_back(std::move(page));
+    E2D_LOG_DEBUG("GLTextureAtlas: created page {} ({}x{})", pages_.size(), pageSize_, pageSize_);
+    return *pages_.back();
+}
+
+// ============================================================================
+// 回收页 - 区域各自持有页纹理，只剩图集自身的引用时说明区域已全部释放
+// ============================================================================
+size_t GLTextureAtlas::releaseUnusedPages() {
+    size_t before = pages_.size();
+    pages_.erase(std::remove_if(pages_.begin(), pages_.end(),
+                                [](const std::unique_ptr<Page>& page) { return page->texture.use_count() == 1; }),
+                 pages_.end());
+    size_t released = before - pages_.size();
+    if (released > 0) {
+        E2D_LOG_DEBUG("GLTextureAtlas: released {} unused pages ({} remaining)", released, pages_.size());
+    }
+    return released;
+}
+
+bool GLTextureAtlas::pack(Page& page, int width, int height, int& x, int& y) {
+    stbrp_rect rect;
+    rect.id = 0;
+    rect.w = width + PADDING * 2;
+    rect.h = height + PADDING * 2;
+
+    stbrp_pack_rects(&page.context, &rect, 1);
+    if (!rect.was_packed) {
+        return false;
+    }
+    x = rect.x + PADDING;
+    y = rect.y + PADDING;
+    return true;
+}
+
+// ============================================================================
+// 添加图片 - 依次尝试已有的页，都放不下时新建一页
+// ============================================================================
+Ptr<TextureRegion> GLTextureAtlas::add(const uint8_t* pixels, int width, int height, int channels) {
+    if (!pixels || width <= 0 || height <= 0 ||
+        width + PADDING * 2 > pageSize_ || height + PADDING * 2 > pageSize_) {
+        return nullptr;
+    }
+
+    Page* target = nullptr;
+    int x = 0, y = 0;
+    for (auto& page : pages_) {
+        if (pack(*page, width, height, x, y)) {
+            target = page.get();
+            break;
+        }
+    }
+    if (!target) {
+        // 新建页之前先回收空页，长时间运行时页数不会只增不减
+        releaseUnusedPages();
+        target = &createPage();
+        if (!pack(*target, width, height, x, y)) {
+            return nullptr;
+        }
+    }
+
+    // 页纹理统一为 RGBA，其他格式在写入 PBO 时转换
+    // 页纹理与普通纹理一样按图片行序上传（第 0 行为图片顶部），
+    // 因此区域的像素坐标可以直接作为精灵的源矩形使用
+    auto& uploader = GLTextureUploader::instance();
+    GLuint pageTexture = target->texture->getTextureID();
+    if (channels == 4) {
+        uploader.upload(pageTexture, x, y, width, height, GL_RGBA, pixels);
+    } else {
+        uploader.upload(pageTexture, x, y, width, height, GL_RGBA, [=](uint8_t* rgba) {
+            for (int i = 0; i < width * height; ++i) {
+                const uint8_t* src = pixels + static_cast<size_t>(i) * channels;
+                uint8_t* dst = rgba + static_cast<size_t>(i) * 4;
+                if (channels == 1) {
+                    dst[0] = dst[1] = dst[2] = src[0];
+                    dst[3] = 255;
+                } else if (channels == 2) {
+                    dst[0] = dst[1] = dst[2] = src[0];
+                    dst[3] = src[1];
+                } else {
+                    dst[0] = src[0];
+                    dst[1] = src[1];
+                    dst[2] = src[2];
+                    dst[3] = 255;
+                }
+            }
+        });
+    }
+
+    return TextureRegion::create(target->texture,
+                                 Rect(static_cast<float>(x), static_cast<float>(y),
+                                      static_cast<float>(width), static_cast<float>(height)));
+}
+
+} // namespace easy2d
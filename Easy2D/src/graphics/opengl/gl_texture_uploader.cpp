@@ -0,0 +1,147 @@
+#include <easy2d/graphics/opengl/gl_texture_uploader.h>
+#include <easy2d/graphics/opengl/gl_state_cache.h>
+#include <easy2d/utils/logger.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace easy2d {
+
+namespace {
+
+size_t bytesPerPixel(GLenum format) {
+    switch (format) {
+        case GL_RED: return 1;
+        case GL_RG:  return 2;
+        case GL_RGB: return 3;
+        default:     return 4;
+    }
+}
+
+// 客户端内存直接上传，行数据紧密排列
+void texSubImage(GLuint texture, int x, int y, int width, int height, GLenum format, const void* pixels) {
+    GLStateCache::instance().bindTextureForUpload(texture);
+    GLint prevUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpackAlignment);
+}
+
+} // namespace
+
+GLTextureUploader& GLTextureUploader::instance() {
+    static GLTextureUploader uploader;
+    return uploader;
+}
+
+void GLTextureUploader::upload(GLuint texture, int x, int y, int width, int height, GLenum format,
+                               const void* pixels) {
+    if (!pixels) {
+        return;
+    }
+    size_t size = static_cast<size_t>(width) * height * bytesPerPixel(format);
+    upload(texture, x, y, width, height, format, [pixels, size](uint8_t* dst) {
+        std::memcpy(dst, pixels, size);
+    });
+}
+
+void GLTextureUploader::upload(GLuint texture, int x, int y, int width, int height, GLenum format,
+                               const FillFunc& fill) {
+    if (texture == 0 || width <= 0 || height <= 0) {
+        return;
+    }
+    size_t size = static_cast<size_t>(width) * height * bytesPerPixel(format);
+
+    size_t offset = 0;
+    uint8_t* mapped = enabled_ ? map(size, offset) : nullptr;
+    if (!mapped) {
+        std::vector<uint8_t> staging(size);
+        fill(staging.data());
+        texSubImage(texture, x, y, width, height, format, staging.data());
+        return;
+    }
+
+    fill(mapped);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+    // PBO 绑定期间，像素指针参数是缓冲区内的偏移
+    texSubImage(texture, x, y, width, height, format, reinterpret_cast<const void*>(offset));
+
+    // 其他代码仍从客户端内存上传，用完立即解绑
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+uint8_t* GLTextureUploader::map(size_t size, size_t& offset) {
+    Buffer* buffer = &buffers_[current_];
+    offset = (buffer->offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+    // 当前 PBO 放不下：插入栅栏后切换到下一个，必要时等待 GPU 用完
+    if (buffer->id != 0 && offset + size > buffer->capacity) {
+        buffer->fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        current_ = (current_ + 1) % BUFFER_COUNT;
+        buffer = &buffers_[current_];
+        waitFence(*buffer);
+        buffer->offset = 0;
+        offset = 0;
+    }
+
+    if (buffer->id == 0) {
+        glGenBuffers(1, &buffer->id);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->id);
+
+    // 重新分配存储：首次使用、超大上传，或超大上传之后恢复默认大小
+    if (offset == 0) {
+        size_t capacity = std::max(BUFFER_SIZE, size);
+        if (buffer->capacity != capacity) {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(capacity), nullptr, GL_STREAM_DRAW);
+            buffer->capacity = capacity;
+        }
+    }
+
+    // 分配的区间不与 GPU 可能仍在读取的区间重叠，无需驱动再做同步
+    void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, static_cast<GLintptr>(offset),
+                                    static_cast<GLsizeiptr>(size),
+                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (!mapped) {
+        E2D_LOG_WARN("GLTextureUploader: failed to map pixel buffer, falling back to direct upload");
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return nullptr;
+    }
+
+    buffer->offset = offset + size;
+    return static_cast<uint8_t*>(mapped);
+}
+
+void GLTextureUploader::waitFence(Buffer& buffer) {
+    if (!buffer.fence) {
+        return;
+    }
+
+    GLenum result = glClientWaitSync(buffer.fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        stallCount_++;
+        do {
+            result = glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+        } while (result == GL_TIMEOUT_EXPIRED);
+    }
+
+    glDeleteSync(buffer.fence);
+    buffer.fence = nullptr;
+}
+
+void GLTextureUploader::shutdown() {
+    for (auto& buffer : buffers_) {
+        if (buffer.fence) {
+            glDeleteSync(buffer.fence);
+        }
+        if (buffer.id != 0) {
+            glDeleteBuffers(1, &buffer.id);
+        }
+        buffer = Buffer{};
+    }
+    current_ = 0;
+}
+
+} // namespace easy2d
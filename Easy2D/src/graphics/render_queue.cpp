@@ -0,0 +1,496 @@
+#include <easy2d/graphics/render_queue.h>
+#include <easy2d/graphics/render_backend.h>
+#include <easy2d/graphics/texture.h>
+#include <easy2d/graphics/font.h>
+#include <easy2d/scene/node.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace easy2d {
+
+// 遮挡网格每个维度的最大单元数
+static constexpr int LAYER_GRID_SIZE = 64;
+// 内存池对齐
+static constexpr size_t ARENA_ALIGNMENT = 8;
+
+RenderQueue::RenderQueue() {
+    textures_.push_back(nullptr);
+    textureKeys_.assign(64, nullptr);
+    textureSlots_.assign(64, 0);
+}
+
+void RenderQueue::clear() {
+    commands_.clear();
+    arenaSize_ = 0;
+    textures_.resize(1);
+    std::fill(textureKeys_.begin(), textureKeys_.end(), nullptr);
+    layerCount_ = 0;
+    sorted_ = false;
+}
+
+uint32_t RenderQueue::allocate(size_t bytes) {
+    size_t offset = (arenaSize_ + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+    size_t end = offset + bytes;
+    if (end > arena_.size()) {
+        arena_.resize(std::max(end, arena_.size() * 2));
+    }
+    arenaSize_ = end;
+    return static_cast<uint32_t>(offset);
+}
+
+Vec2* RenderQueue::allocatePoints(size_t count, uint32_t& offset) {
+    offset = allocate(count * sizeof(Vec2));
+    return reinterpret_cast<Vec2*>(arena_.data() + offset);
+}
+
+// ============================================================================
+// 追加 - 整块复制对方的内存池，再重定位命令的负载偏移和纹理索引
+// ============================================================================
+void RenderQueue::append(const RenderQueue& other) {
+    if (other.commands_.empty()) return;
+
+    uint32_t base = allocate(other.arenaSize_);
+    std::memcpy(arena_.data() + base, other.arena_.data(), other.arenaSize_);
+
+    for (RenderCommand cmd : other.commands_) {
+        cmd.payloadOffset += base;
+        cmd.textureIndex = registerTexture(other.textures_[cmd.textureIndex]);
+        if (cmd.type == RenderCommandType::Polygon || cmd.type == RenderCommandType::FilledPolygon) {
+            auto* polygon = reinterpret_cast<PolygonData*>(arena_.data() + cmd.payloadOffset);
+            polygon->pointOffset += base;
+        }
+        commands_.push_back(cmd);
+    }
+    sorted_ = false;
+}
+
+// ============================================================================
+// 纹理登记 - 开放寻址哈希，每帧清空但保留容量
+// ============================================================================
+static size_t hashTexture(const Texture* texture, size_t mask) {
+    uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(texture)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(h >> 32) & mask;
+}
+
+uint32_t RenderQueue::registerTexture(const Texture* texture) {
+    if (!texture) {
+        return 0;
+    }
+
+    size_t mask = textureKeys_.size() - 1;
+    size_t slot = hashTexture(texture, mask);
+    while (textureKeys_[slot] != nullptr) {
+        if (textureKeys_[slot] == texture) {
+            return textureSlots_[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    uint32_t index = static_cast<uint32_t>(textures_.size());
+    textures_.push_back(texture);
+    textureKeys_[slot] = texture;
+    textureSlots_[slot] = index;
+
+    // 负载超过一半时扩容
+    if (textures_.size() * 2 > textureKeys_.size()) {
+        growTextureTable();
+    }
+    return index;
+}
+
+void RenderQueue::growTextureTable() {
+    size_t capacity = textureKeys_.size() * 2;
+    textureKeys_.assign(capacity, nullptr);
+    textureSlots_.assign(capacity, 0);
+
+    size_t mask = capacity - 1;
+    for (uint32_t i = 1; i < textures_.size(); ++i) {
+        size_t slot = hashTexture(textures_[i], mask);
+        while (textureKeys_[slot] != nullptr) {
+            slot = (slot + 1) & mask;
+        }
+        textureKeys_[slot] = textures_[i];
+        textureSlots_[slot] = i;
+    }
+}
+
+// ============================================================================
+// 排序 - 分配层号，打包排序键，基数排序
+// ============================================================================
+void RenderQueue::sort() {
+    size_t count = std::min<size_t>(commands_.size(), MAX_SEQUENCE);
+
+    assignLayers();
+
+    keys_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        RenderCommand& cmd = commands_[i];
+        uint64_t layer = layers_[i];
+        uint64_t blend = static_cast<uint64_t>(cmd.blendMode) & 0x3;
+        uint64_t shader = static_cast<uint64_t>(cmd.shaderId) & 0xF;
+        uint64_t texture = std::min<uint32_t>(cmd.textureIndex, 0xFFFF);
+        if (layer == MAX_LAYER) {
+            // 层号饱和后无法区分遮挡关系，只按序号排序
+            blend = shader = texture = 0;
+        }
+
+        cmd.sortKey = (layer << 48) | (blend << 46) | (shader << 42) | (texture << 26) | static_cast<uint64_t>(i);
+        keys_[i] = cmd.sortKey;
+    }
+
+    radixSort();
+    sorted_ = true;
+}
+
+// ============================================================================
+// LSD 基数排序（8 位一趟），一次遍历统计所有趟的直方图
+// 键的低位即命令序号，键互不相同，无需额外保持稳定性
+// ============================================================================
+void RenderQueue::radixSort() {
+    size_t count = keys_.size();
+    if (count < 2) return;
+
+    keysTemp_.resize(count);
+
+    uint32_t histograms[8][256] = {};
+    for (uint64_t key : keys_) {
+        for (int pass = 0; pass < 8; ++pass) {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    uint64_t* src = keys_.data();
+    uint64_t* dst = keysTemp_.data();
+    for (int pass = 0; pass < 8; ++pass) {
+        uint32_t* histogram = histograms[pass];
+        int shift = pass * 8;
+
+        // 所有键该字节相同：跳过
+        if (histogram[(src[0] >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (int i = 0; i < 256; ++i) {
+            uint32_t c = histogram[i];
+            histogram[i] = offset;
+            offset += c;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t key = src[i];
+            dst[histogram[(key >> shift) & 0xFF]++] = key;
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != keys_.data()) {
+        keys_.swap(keysTemp_);
+    }
+}
+
+// ============================================================================
+// 层号分配
+// 按收集顺序（画家顺序）遍历命令，用覆盖全部命令范围的粗网格记录每个单元
+// 当前的最高层号。命令的层号 = 所覆盖单元的最高层号 + 1，因此与先前命令
+// 重叠时一定位于更高的层；网格是保守的，只会多分层，不会漏掉遮挡。
+// ============================================================================
+void RenderQueue::assignLayers() {
+    size_t count = std::min<size_t>(commands_.size(), MAX_SEQUENCE);
+    bounds_.resize(count);
+    layers_.resize(count);
+
+    // 计算每条命令的范围和整体范围
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = -std::numeric_limits<float>::max();
+    float maxY = -std::numeric_limits<float>::max();
+    bounded_.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        bounded_[i] = computeBounds(commands_[i], bounds_[i]);
+        if (bounded_[i]) {
+            const Rect& r = bounds_[i];
+            minX = std::min(minX, r.left());
+            minY = std::min(minY, r.top());
+            maxX = std::max(maxX, r.right());
+            maxY = std::max(maxY, r.bottom());
+        }
+    }
+
+    int cellsX = 1;
+    int cellsY = 1;
+    float cellW = 1.0f;
+    float cellH = 1.0f;
+    if (maxX >= minX && maxY >= minY) {
+        float width = std::max(maxX - minX, 1.0f);
+        float height = std::max(maxY - minY, 1.0f);
+        cellsX = LAYER_GRID_SIZE;
+        cellsY = LAYER_GRID_SIZE;
+        cellW = width / cellsX;
+        cellH = height / cellsY;
+    }
+    grid_.assign(static_cast<size_t>(cellsX) * cellsY, -1);
+
+    auto toCell = [](float v, float origin, float cell, int cells) {
+        int c = static_cast<int>((v - origin) / cell);
+        return std::clamp(c, 0, cells - 1);
+    };
+
+    int32_t floorLayer = 0;    // 屏障之后的最低层号
+    int32_t maxLayer = -1;
+
+    for (size_t i = 0; i < count; ++i) {
+        int32_t layer;
+        if (!bounded_[i]) {
+            // 范围未知：排在所有先前命令之后，并阻止后续命令越过
+            layer = std::max(floorLayer, maxLayer + 1);
+            floorLayer = layer + 1;
+        } else {
+            const Rect& r = bounds_[i];
+            int x0 = toCell(r.left(), minX, cellW, cellsX);
+            int x1 = toCell(r.right(), minX, cellW, cellsX);
+            int y0 = toCell(r.top(), minY, cellH, cellsY);
+            int y1 = toCell(r.bottom(), minY, cellH, cellsY);
+
+            int32_t covered = -1;
+            for (int y = y0; y <= y1; ++y) {
+                const int32_t* row = &grid_[static_cast<size_t>(y) * cellsX];
+                for (int x = x0; x <= x1; ++x) {
+                    covered = std::max(covered, row[x]);
+                }
+            }
+
+            layer = std::max(floorLayer, covered + 1);
+            for (int y = y0; y <= y1; ++y) {
+                int32_t* row = &grid_[static_cast<size_t>(y) * cellsX];
+                for (int x = x0; x <= x1; ++x) {
+                    row[x] = layer;
+                }
+            }
+        }
+
+        // 层号超出键宽时饱和，饱和层内的命令只按序号排序（见 sort）
+        layer = std::min<int32_t>(layer, MAX_LAYER);
+        layers_[i] = static_cast<uint16_t>(layer);
+        maxLayer = std::max(maxLayer, layer);
+    }
+
+    layerCount_ = static_cast<uint32_t>(maxLayer + 1);
+}
+
+// ============================================================================
+// 计算命令的绘制范围，范围未知时返回 false
+// ============================================================================
+bool RenderQueue::computeBounds(const RenderCommand& command, Rect& bounds) const {
+    auto fromPoints = [&bounds](const Vec2* points, size_t count, float inflate) {
+        float minX = points[0].x, minY = points[0].y;
+        float maxX = minX, maxY = minY;
+        for (size_t i = 1; i < count; ++i) {
+            minX = std::min(minX, points[i].x);
+            minY = std::min(minY, points[i].y);
+            maxX = std::max(maxX, points[i].x);
+            maxY = std::max(maxY, points[i].y);
+        }
+        bounds = Rect(minX - inflate, minY - inflate,
+                      maxX - minX + inflate * 2.0f, maxY - minY + inflate * 2.0f);
+    };
+    // 与渲染器的线宽处理一致（最小 1 像素）
+    auto halfWidth = [](float width) { return std::max(width, 1.0f) * 0.5f; };
+
+    switch (command.type) {
+        case RenderCommandType::Sprite: {
+            // 与精灵批处理的顶点变换一致：绕目标矩形原点按锚点偏移旋转
+            const auto& d = getPayload<SpriteData>(command);
+            float w = d.destRect.size.width;
+            float h = d.destRect.size.height;
+            float ax = w * d.anchor.x;
+            float ay = h * d.anchor.y;
+            float rad = d.rotation * 3.14159f / 180.0f;
+            float c = cosf(rad);
+            float s = sinf(rad);
+            Vec2 corners[4];
+            const float local[4][2] = { {0, 0}, {w, 0}, {w, h}, {0, h} };
+            for (int i = 0; i < 4; ++i) {
+                float rx = local[i][0] - ax;
+                float ry = local[i][1] - ay;
+                corners[i] = Vec2(d.destRect.origin.x + rx * c - ry * s,
+                                  d.destRect.origin.y + rx * s + ry * c);
+            }
+            fromPoints(corners, 4, 0.0f);
+            return true;
+        }
+        case RenderCommandType::Line: {
+            const auto& d = getPayload<LineData>(command);
+            Vec2 points[2] = { d.start, d.end };
+            fromPoints(points, 2, halfWidth(d.width));
+            return true;
+        }
+        case RenderCommandType::Rect:
+        case RenderCommandType::FilledRect: {
+            const auto& d = getPayload<RectData>(command);
+            Vec2 points[2] = { d.rect.origin, Vec2(d.rect.right(), d.rect.bottom()) };
+            float inflate = command.type == RenderCommandType::Rect ? halfWidth(d.width) : 0.0f;
+            fromPoints(points, 2, inflate);
+            return true;
+        }
+        case RenderCommandType::Circle:
+        case RenderCommandType::FilledCircle: {
+            const auto& d = getPayload<CircleData>(command);
+            float r = std::abs(d.radius);
+            if (command.type == RenderCommandType::Circle) {
+                r += halfWidth(d.width);
+            }
+            bounds = Rect(d.center.x - r, d.center.y - r, r * 2.0f, r * 2.0f);
+            return true;
+        }
+        case RenderCommandType::Triangle:
+        case RenderCommandType::FilledTriangle: {
+            const auto& d = getPayload<TriangleData>(command);
+            Vec2 points[3] = { d.p1, d.p2, d.p3 };
+            float inflate = command.type == RenderCommandType::Triangle ? halfWidth(d.width) : 0.0f;
+            fromPoints(points, 3, inflate);
+            return true;
+        }
+        case RenderCommandType::Polygon:
+        case RenderCommandType::FilledPolygon: {
+            const auto& d = getPayload<PolygonData>(command);
+            if (d.pointCount == 0) {
+                bounds = Rect();
+                return true;
+            }
+            float inflate = command.type == RenderCommandType::Polygon ? halfWidth(d.width) : 0.0f;
+            fromPoints(getPoints(d.pointOffset), d.pointCount, inflate);
+            return true;
+        }
+        case RenderCommandType::Text: {
+            // 字形可能略微超出行高，按字号留出余量
+            const auto& d = getPayload<TextData>(command);
+            float margin = d.font ? d.font->getFontSize() * 0.25f : 0.0f;
+            bounds = Rect(d.position.x - margin, d.position.y - margin,
+                          d.size.x + margin * 2.0f, d.size.y + margin * 2.0f);
+            return true;
+        }
+        case RenderCommandType::Custom: {
+            const auto& d = getPayload<CustomData>(command);
+            bounds = d.bounds;
+            return !d.bounds.empty();
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// 提交 - 按排序结果依次调用渲染后端，连续的同纹理命令由后端合并为一个批次
+// ============================================================================
+void RenderQueue::submit(RenderBackend& renderer) {
+    if (!sorted_) {
+        sort();
+    }
+
+    bool blendKnown = false;
+    BlendMode currentBlend = BlendMode::Alpha;
+
+    for (uint64_t key : keys_) {
+        const RenderCommand& cmd = commands_[key & MAX_SEQUENCE];
+
+        if (!blendKnown || cmd.blendMode != currentBlend) {
+            renderer.setBlendMode(cmd.blendMode);
+            currentBlend = cmd.blendMode;
+            blendKnown = true;
+        }
+
+        execute(cmd, renderer);
+
+        // 自定义绘制可能修改渲染状态
+        if (cmd.type == RenderCommandType::Custom) {
+            blendKnown = false;
+        }
+    }
+
+    // 恢复默认混合模式
+    if (!blendKnown || currentBlend != BlendMode::Alpha) {
+        renderer.setBlendMode(BlendMode::Alpha);
+    }
+}
+
+void RenderQueue::execute(const RenderCommand& command, RenderBackend& renderer) {
+    switch (command.type) {
+        case RenderCommandType::Sprite: {
+            const auto& d = getPayload<SpriteData>(command);
+            const Texture* texture = getTexture(command);
+            if (texture) {
+                renderer.drawSprite(*texture, d.destRect, d.srcRect, d.tint, d.rotation, d.anchor);
+            }
+            break;
+        }
+        case RenderCommandType::Line: {
+            const auto& d = getPayload<LineData>(command);
+            renderer.drawLine(d.start, d.end, d.color, d.width);
+            break;
+        }
+        case RenderCommandType::Rect: {
+            const auto& d = getPayload<RectData>(command);
+            renderer.drawRect(d.rect, d.color, d.width);
+            break;
+        }
+        case RenderCommandType::FilledRect: {
+            const auto& d = getPayload<RectData>(command);
+            renderer.fillRect(d.rect, d.color);
+            break;
+        }
+        case RenderCommandType::Circle: {
+            const auto& d = getPayload<CircleData>(command);
+            renderer.drawCircle(d.center, d.radius, d.color, d.segments, d.width);
+            break;
+        }
+        case RenderCommandType::FilledCircle: {
+            const auto& d = getPayload<CircleData>(command);
+            renderer.fillCircle(d.center, d.radius, d.color, d.segments);
+            break;
+        }
+        case RenderCommandType::Triangle: {
+            const auto& d = getPayload<TriangleData>(command);
+            renderer.drawTriangle(d.p1, d.p2, d.p3, d.color, d.width);
+            break;
+        }
+        case RenderCommandType::FilledTriangle: {
+            const auto& d = getPayload<TriangleData>(command);
+            renderer.fillTriangle(d.p1, d.p2, d.p3, d.color);
+            break;
+        }
+        case RenderCommandType::Polygon:
+        case RenderCommandType::FilledPolygon: {
+            // 后端接口接收 vector，复用临时缓冲避免分配
+            const auto& d = getPayload<PolygonData>(command);
+            const Vec2* points = getPoints(d.pointOffset);
+            polygonScratch_.assign(points, points + d.pointCount);
+            if (command.type == RenderCommandType::Polygon) {
+                renderer.drawPolygon(polygonScratch_, d.color, d.width);
+            } else {
+                renderer.fillPolygon(polygonScratch_, d.color);
+            }
+            break;
+        }
+        case RenderCommandType::Text: {
+            const auto& d = getPayload<TextData>(command);
+            if (d.run) {
+                renderer.drawGlyphRun(*d.run, d.position, d.color);
+            } else if (d.font && d.text) {
+                renderer.drawText(*d.font, *d.text, d.position, d.color);
+            }
+            break;
+        }
+        case RenderCommandType::Custom: {
+            const auto& d = getPayload<CustomData>(command);
+            if (d.node) {
+                d.node->onDraw(renderer);
+            }
+            break;
+        }
+    }
+}
+
+} // namespace easy2d
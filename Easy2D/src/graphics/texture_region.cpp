@@ -0,0 +1,45 @@
+#include <easy2d/graphics/texture_region.h>
+
+namespace easy2d {
+
+TextureRegion::TextureRegion(Ptr<Texture> page, const Rect& region)
+    : page_(std::move(page)), region_(region) {
+}
+
+Ptr<TextureRegion> TextureRegion::create(Ptr<Texture> page, const Rect& region) {
+    return makePtr<TextureRegion>(std::move(page), region);
+}
+
+int TextureRegion::getChannels() const {
+    return page_ ? page_->getChannels() : 0;
+}
+
+void* TextureRegion::getNativeHandle() const {
+    return page_ ? page_->getNativeHandle() : nullptr;
+}
+
+bool TextureRegion::isValid() const {
+    return page_ && page_->isValid() && !region_.empty();
+}
+
+void TextureRegion::setFilter(bool linear) {
+    if (page_) {
+        page_->setFilter(linear);
+    }
+}
+
+void TextureRegion::setWrap(bool /*repeat*/) {
+}
+
+const Texture& TextureRegion::getSourceTexture() const {
+    return page_ ? page_->getSourceTexture() : *this;
+}
+
+Vec2 TextureRegion::getSourceOffset() const {
+    if (!page_) {
+        return region_.origin;
+    }
+    return page_->getSourceOffset() + region_.origin;
+}
+
+} // namespace easy2d
@@ -0,0 +1,279 @@
+#include <easy2d/resource/asset_bundle.h>
+#include <easy2d/resource/asset_bundle_format.h>
+#include <easy2d/graphics/texture_region.h>
+#include <easy2d/graphics/opengl/gl_texture.h>
+#include <easy2d/graphics/opengl/gl_texture_uploader.h>
+#include <easy2d/utils/logger.h>
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace easy2d {
+
+namespace {
+
+// ============================================================================
+// 只读内存映射文件
+// ============================================================================
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) return;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file_, &fileSize) || fileSize.QuadPart == 0) return;
+
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) return;
+
+        data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_) {
+            size_ = static_cast<size_t>(fileSize.QuadPart);
+        }
+#else
+        fd_ = open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) return;
+
+        struct stat st;
+        if (fstat(fd_, &st) != 0 || st.st_size == 0) return;
+
+        void* mapped = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (mapped != MAP_FAILED) {
+            data_ = static_cast<const uint8_t*>(mapped);
+            size_ = static_cast<size_t>(st.st_size);
+        }
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (data_) UnmapViewOfFile(data_);
+        if (mapping_) CloseHandle(mapping_);
+        if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+        if (data_) munmap(const_cast<uint8_t*>(data_), size_);
+        if (fd_ >= 0) close(fd_);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// ============================================================================
+// 预光栅化字体 - 字形集合在离线烘焙时确定，不包含的字符不会显示
+// ============================================================================
+class BakedFontAtlas : public FontAtlas {
+public:
+    BakedFontAtlas(Ptr<Texture> texture, int fontSize, bool useSDF,
+                   float ascent, float descent, float lineGap)
+        : texture_(std::move(texture))
+        , fontSize_(fontSize)
+        , useSDF_(useSDF)
+        , ascent_(ascent)
+        , descent_(descent)
+        , lineGap_(lineGap) {
+    }
+
+    void addGlyph(char32_t codepoint, const Glyph& glyph) { glyphs_[codepoint] = glyph; }
+
+    const Glyph* getGlyph(char32_t codepoint) const override {
+        auto it = glyphs_.find(codepoint);
+        return it != glyphs_.end() ? &it->second : nullptr;
+    }
+
+    Texture* getTexture() const override { return texture_.get(); }
+    int getFontSize() const override { return fontSize_; }
+    float getAscent() const override { return ascent_; }
+    float getDescent() const override { return descent_; }
+    float getLineGap() const override { return lineGap_; }
+    float getLineHeight() const override { return ascent_ - descent_ + lineGap_; }
+    bool isSDF() const override { return useSDF_; }
+
+    Vec2 measureText(const String& text) override {
+        float width = 0.0f;
+        float height = getAscent() - getDescent();
+        float currentWidth = 0.0f;
+
+        for (char32_t codepoint : text.toUtf32()) {
+            if (codepoint == '\n') {
+                width = std::max(width, currentWidth);
+                currentWidth = 0.0f;
+                height += getLineHeight();
+                continue;
+            }
+
+            const Glyph* glyph = getGlyph(codepoint);
+            if (glyph) {
+                currentWidth += glyph->advance;
+            }
+        }
+
+        width = std::max(width, currentWidth);
+        return Vec2(width, height);
+    }
+
+private:
+    Ptr<Texture> texture_;
+    int fontSize_;
+    bool useSDF_;
+    float ascent_;
+    float descent_;
+    float lineGap_;
+    std::unordered_map<char32_t, Glyph> glyphs_;
+};
+
+// 上传一张图集页，像素数据已是 GL 的行序，直接拷贝到纹理
+Ptr<GLTexture> uploadPage(const bundle::PageEntry& entry, const uint8_t* pixels) {
+    bool singleChannel = entry.format == bundle::PixelFormat::R8;
+    int width = static_cast<int>(entry.width);
+    int height = static_cast<int>(entry.height);
+
+    // 不把像素交给 GLTexture，避免它在内存中保留一份副本
+    auto texture = makePtr<GLTexture>(width, height, nullptr, singleChannel ? 1 : 4);
+    GLTextureUploader::instance().upload(texture->getTextureID(), 0, 0, width, height,
+                                         singleChannel ? GL_RED : GL_RGBA, pixels);
+    return texture;
+}
+
+} // namespace
+
+// ============================================================================
+// 加载资源包
+// ============================================================================
+Ptr<AssetBundle> AssetBundle::load(const std::string& filepath) {
+    MappedFile file(filepath);
+    if (!file.data()) {
+        E2D_LOG_ERROR("AssetBundle: failed to map file: {}", filepath);
+        return nullptr;
+    }
+
+    auto assetBundle = makePtr<AssetBundle>();
+    assetBundle->path_ = filepath;
+    if (!assetBundle->parse(file.data(), file.size())) {
+        E2D_LOG_ERROR("AssetBundle: invalid bundle: {}", filepath);
+        return nullptr;
+    }
+
+    E2D_LOG_INFO("AssetBundle: loaded {} ({} pages, {} textures, {} fonts)", filepath,
+                 assetBundle->pages_.size(), assetBundle->textures_.size(), assetBundle->fonts_.size());
+    return assetBundle;
+}
+
+bool AssetBundle::parse(const uint8_t* data, size_t size) {
+    using namespace bundle;
+
+    if (size < sizeof(Header)) return false;
+    const auto& header = *reinterpret_cast<const Header*>(data);
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) return false;
+    if (header.version != VERSION) {
+        E2D_LOG_ERROR("AssetBundle: unsupported version {} (expected {})", header.version, VERSION);
+        return false;
+    }
+
+    // 校验各表都在文件范围内
+    uint64_t tablesEnd = sizeof(Header)
+        + static_cast<uint64_t>(header.pageCount) * sizeof(PageEntry)
+        + static_cast<uint64_t>(header.regionCount) * sizeof(RegionEntry)
+        + static_cast<uint64_t>(header.fontCount) * sizeof(FontEntry)
+        + static_cast<uint64_t>(header.glyphCount) * sizeof(GlyphEntry);
+    if (tablesEnd > size || header.stringsOffset + header.stringsSize > size) return false;
+
+    const auto* pages = reinterpret_cast<const PageEntry*>(data + sizeof(Header));
+    const auto* regions = reinterpret_cast<const RegionEntry*>(pages + header.pageCount);
+    const auto* fonts = reinterpret_cast<const FontEntry*>(regions + header.regionCount);
+    const auto* glyphs = reinterpret_cast<const GlyphEntry*>(fonts + header.fontCount);
+    const char* strings = reinterpret_cast<const char*>(data + header.stringsOffset);
+
+    auto readName = [&](uint32_t offset, uint32_t length, std::string& name) {
+        if (static_cast<uint64_t>(offset) + length > header.stringsSize) return false;
+        name.assign(strings + offset, length);
+        return true;
+    };
+
+    // 图集页
+    pages_.reserve(header.pageCount);
+    for (uint32_t i = 0; i < header.pageCount; ++i) {
+        const PageEntry& page = pages[i];
+        uint64_t bytesPerPixel = page.format == PixelFormat::R8 ? 1 : 4;
+        uint64_t expected = static_cast<uint64_t>(page.width) * page.height * bytesPerPixel;
+        if (page.width == 0 || page.height == 0 || page.dataSize != expected ||
+            page.dataOffset + page.dataSize > size) {
+            return false;
+        }
+        pages_.push_back(uploadPage(page, data + page.dataOffset));
+    }
+
+    // 图片区域
+    std::string name;
+    for (uint32_t i = 0; i < header.regionCount; ++i) {
+        const RegionEntry& region = regions[i];
+        if (region.page >= pages_.size() || !readName(region.nameOffset, region.nameLength, name)) {
+            return false;
+        }
+        textures_[name] = TextureRegion::create(pages_[region.page],
+                                                Rect(region.x, region.y, region.width, region.height));
+    }
+
+    // 字体
+    for (uint32_t i = 0; i < header.fontCount; ++i) {
+        const FontEntry& entry = fonts[i];
+        if (entry.page >= pages_.size() ||
+            static_cast<uint64_t>(entry.firstGlyph) + entry.glyphCount > header.glyphCount ||
+            !readName(entry.nameOffset, entry.nameLength, name)) {
+            return false;
+        }
+
+        bool useSDF = (entry.flags & FONT_FLAG_SDF) != 0;
+        pages_[entry.page]->setFilter(true);
+        auto font = makePtr<BakedFontAtlas>(pages_[entry.page], entry.fontSize, useSDF,
+                                            entry.ascent, entry.descent, entry.lineGap);
+        for (uint32_t g = 0; g < entry.glyphCount; ++g) {
+            const GlyphEntry& src = glyphs[entry.firstGlyph + g];
+            Glyph glyph;
+            glyph.u0 = src.u0;
+            glyph.v0 = src.v0;
+            glyph.u1 = src.u1;
+            glyph.v1 = src.v1;
+            glyph.width = src.width;
+            glyph.height = src.height;
+            glyph.bearingX = src.bearingX;
+            glyph.bearingY = src.bearingY;
+            glyph.advance = src.advance;
+            font->addGlyph(static_cast<char32_t>(src.codepoint), glyph);
+        }
+        fonts_.push_back(FontInfo{ name, entry.fontSize, useSDF, font });
+    }
+    return true;
+}
+
+Ptr<Texture> AssetBundle::getTexture(const std::string& name) const {
+    auto it = textures_.find(name);
+    return it != textures_.end() ? it->second : nullptr;
+}
+
+} // namespace easy2d
@@ -1,15 +1,44 @@
 #include <easy2d/resource/resource_manager.h>
+#include <easy2d/resource/asset_bundle.h>
+#include <easy2d/resource/texture_handle.h>
 #include <easy2d/graphics/opengl/gl_texture.h>
 #include <easy2d/graphics/opengl/gl_font_atlas.h>
+#include <easy2d/graphics/opengl/gl_texture_atlas.h>
 #include <easy2d/audio/audio_engine.h>
+#include <easy2d/utils/thread_pool.h>
 #include <easy2d/utils/logger.h>
 #include <algorithm>
 #include <filesystem>
 #include <cstring>
+#include <deque>
+#include <stb/stb_image.h>
 
 namespace easy2d {
 
-ResourceManager::ResourceManager() = default;
+// ============================================================================
+// 异步加载的中间数据
+// ============================================================================
+struct ResourceManager::DecodedImage {
+    std::string key;
+    std::string fullPath;
+    TextureLoadOptions options;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+    GLTexture::PixelBuffer pixels{ nullptr, stbi_image_free };
+
+    size_t byteSize() const { return static_cast<size_t>(width) * height * channels; }
+};
+
+struct ResourceManager::AsyncUploadQueue {
+    std::mutex mutex;
+    std::deque<Ptr<DecodedImage>> decoded;
+};
+
+ResourceManager::ResourceManager()
+    : uploadQueue_(makePtr<AsyncUploadQueue>()) {
+}
+
 ResourceManager::~ResourceManager() = default;
 
 ResourceManager& ResourceManager::getInstance() {
@@ -70,7 +99,7 @@ std::string ResourceManager::findResourcePath(const std::string& filename) const
 // 纹理资源
 // ============================================================================
 
-Ptr<Texture> ResourceManager::loadTexture(const std::string& filepath) {
+Ptr<Texture> ResourceManager::loadTexture(const std::string& filepath, const TextureLoadOptions& options) {
     std::lock_guard<std::mutex> lock(textureMutex_);
     
     // 检查缓存
@@ -91,9 +120,19 @@ Ptr<Texture> ResourceManager::loadTexture(const std::string& filepath) {
         return nullptr;
     }
     
+    // 优先打包进图集（需要保留 CPU 数据或 mipmap 的纹理总是独立创建）
+    bool allowAtlas = !options.keepPixels && !options.keepAlphaMask && !options.mipmaps;
+    if (allowAtlas && atlasEnabled_) {
+        if (auto region = loadTextureIntoAtlas(fullPath)) {
+            textureCache_[filepath] = region;
+            E2D_LOG_DEBUG("ResourceManager: loaded texture into atlas: {}", filepath);
+            return region;
+        }
+    }
+    
     // 创建新纹理
     try {
-        auto texture = makePtr<GLTexture>(fullPath);
+        auto texture = makePtr<GLTexture>(fullPath, options);
         if (!texture->isValid()) {
             E2D_LOG_ERROR("ResourceManager: failed to load texture: {}", filepath);
             return nullptr;
@@ -101,7 +140,7 @@ Ptr<Texture> ResourceManager::loadTexture(const std::string& filepath) {
         
         // 存入缓存
         textureCache_[filepath] = texture;
-        E2D_LOG_DEBUG("ResourceManager: loaded texture: {}", filepath);
+        E2D_LOG_DEBUG("ResourceManager: loaded texture: {} ({} bytes)", filepath, texture->getMemoryUsage());
         return texture;
     } catch (...) {
         E2D_LOG_ERROR("ResourceManager: exception loading texture: {}", filepath);
@@ -109,17 +148,236 @@ Ptr<Texture> ResourceManager::loadTexture(const std::string& filepath) {
     }
 }
 
+Ptr<Texture> ResourceManager::loadTextureIntoAtlas(const std::string& fullPath) {
+    // 先只读取图片头，大图片不解码两次
+    int width = 0, height = 0, channels = 0;
+    if (!stbi_info(fullPath.c_str(), &width, &height, &channels) ||
+        width > atlasMaxImageSize_ || height > atlasMaxImageSize_) {
+        return nullptr;
+    }
+
+    stbi_set_flip_vertically_on_load(false);
+    uint8_t* data = stbi_load(fullPath.c_str(), &width, &height, &channels, 0);
+    if (!data) {
+        return nullptr;
+    }
+
+    if (!atlas_) {
+        atlas_ = makeUnique<GLTextureAtlas>(atlasPageSize_);
+    }
+    Ptr<Texture> region = atlas_->add(data, width, height, channels);
+    stbi_image_free(data);
+    return region;
+}
+
+// ============================================================================
+// 异步纹理加载
+// ============================================================================
+
+void ResourceManager::setThreadPool(ThreadPool* pool) {
+    std::lock_guard<std::mutex> lock(textureMutex_);
+    threadPool_ = pool;
+}
+
+Ptr<TextureHandle> ResourceManager::loadTextureAsync(const std::string& filepath,
+                                                     const TextureLoadOptions& options) {
+    auto handle = makePtr<TextureHandle>(filepath);
+
+    // findResourcePath 内部会加锁，先于缓存锁调用
+    std::string fullPath = findResourcePath(filepath);
+
+    std::lock_guard<std::mutex> lock(textureMutex_);
+
+    // 已缓存：句柄立即就绪
+    auto it = textureCache_.find(filepath);
+    if (it != textureCache_.end()) {
+        if (auto texture = it->second.lock()) {
+            handle->complete(texture);
+            return handle;
+        }
+        textureCache_.erase(it);
+    }
+
+    // 正在加载：共用同一个句柄
+    auto pending = pendingTextures_.find(filepath);
+    if (pending != pendingTextures_.end()) {
+        return pending->second;
+    }
+
+    if (fullPath.empty()) {
+        E2D_LOG_ERROR("ResourceManager: texture file not found: {}", filepath);
+        handle->complete(nullptr);
+        return handle;
+    }
+
+    auto image = makePtr<DecodedImage>();
+    image->key = filepath;
+    image->fullPath = fullPath;
+    image->options = options;
+    pendingTextures_[filepath] = handle;
+
+    // 解码任务只接触自己的图片和共享的上传队列
+    auto queue = uploadQueue_;
+    auto decode = [queue, image]() {
+        stbi_set_flip_vertically_on_load_thread(false);
+        image->pixels.reset(stbi_load(image->fullPath.c_str(), &image->width, &image->height,
+                                      &image->channels, 0));
+        std::lock_guard<std::mutex> queueLock(queue->mutex);
+        queue->decoded.push_back(image);
+    };
+
+    if (threadPool_) {
+        threadPool_->submit(std::move(decode));
+    } else {
+        decode();
+    }
+    return handle;
+}
+
+size_t ResourceManager::processAsyncUploads(size_t byteBudget) {
+    size_t processed = 0;
+    size_t uploadedBytes = 0;
+
+    while (processed == 0 || uploadedBytes < byteBudget) {
+        Ptr<DecodedImage> image;
+        {
+            std::lock_guard<std::mutex> queueLock(uploadQueue_->mutex);
+            if (uploadQueue_->decoded.empty()) {
+                break;
+            }
+            image = std::move(uploadQueue_->decoded.front());
+            uploadQueue_->decoded.pop_front();
+        }
+
+        Ptr<TextureHandle> handle;
+        Ptr<Texture> texture;
+        {
+            std::lock_guard<std::mutex> lock(textureMutex_);
+            texture = createDecodedTexture(*image);
+
+            auto it = pendingTextures_.find(image->key);
+            if (it != pendingTextures_.end()) {
+                handle = std::move(it->second);
+                pendingTextures_.erase(it);
+            }
+        }
+
+        uploadedBytes += image->byteSize();
+        ++processed;
+
+        // 回调可能加载其他资源，在锁外执行
+        if (handle) {
+            handle->complete(texture);
+        }
+    }
+    return processed;
+}
+
+Ptr<Texture> ResourceManager::createDecodedTexture(DecodedImage& image) {
+    // 解码期间可能已被同步加载
+    auto it = textureCache_.find(image.key);
+    if (it != textureCache_.end()) {
+        if (auto texture = it->second.lock()) {
+            return texture;
+        }
+    }
+
+    if (!image.pixels) {
+        E2D_LOG_ERROR("ResourceManager: failed to decode texture: {}", image.key);
+        return nullptr;
+    }
+
+    const TextureLoadOptions& options = image.options;
+    bool allowAtlas = !options.keepPixels && !options.keepAlphaMask && !options.mipmaps;
+    Ptr<Texture> texture;
+    if (allowAtlas && atlasEnabled_ &&
+        image.width <= atlasMaxImageSize_ && image.height <= atlasMaxImageSize_) {
+        if (!atlas_) {
+            atlas_ = makeUnique<GLTextureAtlas>(atlasPageSize_);
+        }
+        texture = atlas_->add(image.pixels.get(), image.width, image.height, image.channels);
+    }
+
+    if (!texture) {
+        texture = makePtr<GLTexture>(image.width, image.height, std::move(image.pixels),
+                                     image.channels, options);
+    }
+
+    textureCache_[image.key] = texture;
+    E2D_LOG_DEBUG("ResourceManager: uploaded async texture: {}", image.key);
+    return texture;
+}
+
+size_t ResourceManager::getPendingTextureCount() const {
+    std::lock_guard<std::mutex> lock(textureMutex_);
+    return pendingTextures_.size();
+}
+
+void ResourceManager::setTextureAtlasEnabled(bool enabled, int pageSize, int maxImageSize) {
+    std::lock_guard<std::mutex> lock(textureMutex_);
+    atlasEnabled_ = enabled;
+    atlasMaxImageSize_ = maxImageSize;
+    if (pageSize != atlasPageSize_) {
+        // 已有的区域仍持有旧页纹理，新图片从新尺寸的页开始打包
+        atlasPageSize_ = pageSize;
+        atlas_.reset();
+    }
+    E2D_LOG_DEBUG("ResourceManager: texture atlas {} (page {}, max image {})",
+                  enabled ? "enabled" : "disabled", pageSize, maxImageSize);
+}
+
+bool ResourceManager::isTextureAtlasEnabled() const {
+    std::lock_guard<std::mutex> lock(textureMutex_);
+    return atlasEnabled_;
+}
+
+size_t ResourceManager::getTextureAtlasPageCount() const {
+    std::lock_guard<std::mutex> lock(textureMutex_);
+    return atlas_ ? atlas_->getPageCount() : 0;
+}
+
 Ptr<Texture> ResourceManager::loadTextureWithAlphaMask(const std::string& filepath) {
-    // 先加载纹理
-    auto texture = loadTexture(filepath);
+    // 加载纹理时直接生成遮罩，不保留完整像素
+    TextureLoadOptions options;
+    options.keepAlphaMask = true;
+    auto texture = loadTexture(filepath, options);
     if (!texture) {
         return nullptr;
     }
-    
-    // 生成Alpha遮罩
-    generateAlphaMask(filepath);
-    
-    return texture;
+
+    const AlphaMask* mask = texture->getAlphaMask();
+    if (mask && mask->isValid()) {
+        return texture;
+    }
+
+    // 缓存命中的纹理是按其他选项加载的，没有遮罩：重新解码文件补上
+    std::string fullPath = findResourcePath(filepath);
+    int width = 0, height = 0, channels = 0;
+    stbi_set_flip_vertically_on_load(false);
+    GLTexture::PixelBuffer pixels(fullPath.empty() ? nullptr :
+                                  stbi_load(fullPath.c_str(), &width, &height, &channels, 0),
+                                  stbi_image_free);
+    if (!pixels) {
+        E2D_LOG_ERROR("ResourceManager: failed to decode texture for alpha mask: {}", filepath);
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(textureMutex_);
+    if (auto* glTexture = dynamic_cast<GLTexture*>(texture.get())) {
+        glTexture->setAlphaMask(AlphaMask::createFromPixels(pixels.get(), width, height, channels));
+        E2D_LOG_DEBUG("ResourceManager: attached alpha mask to cached texture: {}", filepath);
+        return texture;
+    }
+
+    // 图集区域无法携带遮罩，改用独立纹理并替换缓存项；已有的持有者继续使用原区域
+    auto standalone = makePtr<GLTexture>(width, height, std::move(pixels), channels, options);
+    if (!standalone->isValid()) {
+        E2D_LOG_ERROR("ResourceManager: failed to load texture: {}", filepath);
+        return nullptr;
+    }
+    textureCache_[filepath] = standalone;
+    E2D_LOG_DEBUG("ResourceManager: reloaded atlas texture with alpha mask: {}", filepath);
+    return standalone;
 }
 
 const AlphaMask* ResourceManager::getAlphaMask(const std::string& textureKey) const {
@@ -128,8 +386,7 @@ const AlphaMask* ResourceManager::getAlphaMask(const std::string& textureKey) co
     auto it = textureCache_.find(textureKey);
     if (it != textureCache_.end()) {
         if (auto texture = it->second.lock()) {
-            GLTexture* glTexture = static_cast<GLTexture*>(texture.get());
-            return glTexture->getAlphaMask();
+            return texture->getAlphaMask();
         }
     }
     return nullptr;
@@ -141,7 +398,11 @@ bool ResourceManager::generateAlphaMask(const std::string& textureKey) {
     auto it = textureCache_.find(textureKey);
     if (it != textureCache_.end()) {
         if (auto texture = it->second.lock()) {
-            GLTexture* glTexture = static_cast<GLTexture*>(texture.get());
+            GLTexture* glTexture = dynamic_cast<GLTexture*>(texture.get());
+            if (!glTexture) {
+                E2D_LOG_WARN("ResourceManager: cannot generate alpha mask for atlas texture: {}", textureKey);
+                return false;
+            }
             if (!glTexture->hasAlphaMask()) {
                 glTexture->generateAlphaMask();
             }
@@ -157,8 +418,8 @@ bool ResourceManager::hasAlphaMask(const std::string& textureKey) const {
     auto it = textureCache_.find(textureKey);
     if (it != textureCache_.end()) {
         if (auto texture = it->second.lock()) {
-            GLTexture* glTexture = static_cast<GLTexture*>(texture.get());
-            return glTexture->hasAlphaMask();
+            const AlphaMask* mask = texture->getAlphaMask();
+            return mask && mask->isValid();
         }
     }
     return false;
@@ -239,6 +500,23 @@ Ptr<FontAtlas> ResourceManager::loadFont(const std::string& filepath, int fontSi
     }
 }
 
+void ResourceManager::setFontAtlasConfig(const FontAtlasConfig& config) {
+    GLFontAtlas::setDefaultConfig(config);
+}
+
+void ResourceManager::prewarmFont(const Ptr<FontAtlas>& font, const String& text) {
+    if (!font) {
+        return;
+    }
+
+    ThreadPool* pool = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(textureMutex_);
+        pool = threadPool_;
+    }
+    font->prewarm(text, pool);
+}
+
 Ptr<FontAtlas> ResourceManager::getFont(const std::string& key) const {
     std::lock_guard<std::mutex> lock(fontMutex_);
     
@@ -265,6 +543,47 @@ void ResourceManager::unloadFont(const std::string& key) {
     E2D_LOG_DEBUG("ResourceManager: unloaded font: {}", key);
 }
 
+// ============================================================================
+// 资源包
+// ============================================================================
+
+bool ResourceManager::loadBundle(const std::string& filepath) {
+    std::string fullPath = findResourcePath(filepath);
+    if (fullPath.empty()) {
+        E2D_LOG_ERROR("ResourceManager: bundle file not found: {}", filepath);
+        return false;
+    }
+
+    auto assetBundle = AssetBundle::load(fullPath);
+    if (!assetBundle) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(textureMutex_);
+        for (const auto& [name, texture] : assetBundle->getTextures()) {
+            textureCache_[name] = texture;
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(fontMutex_);
+        for (const auto& font : assetBundle->getFonts()) {
+            fontCache_[makeFontKey(font.name, font.fontSize, font.useSDF)] = font.font;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(bundleMutex_);
+    bundles_.push_back(std::move(assetBundle));
+    return true;
+}
+
+void ResourceManager::unloadBundles() {
+    std::lock_guard<std::mutex> lock(bundleMutex_);
+    size_t count = bundles_.size();
+    bundles_.clear();
+    E2D_LOG_INFO("ResourceManager: unloaded {} bundles", count);
+}
+
 // ============================================================================
 // 音效资源
 // ============================================================================
@@ -352,6 +671,9 @@ void ResourceManager::purgeUnused() {
                 ++it;
             }
         }
+        if (atlas_) {
+            atlas_->releaseUnusedPages();
+        }
     }
     
     // 清理字体缓存
@@ -385,6 +707,8 @@ void ResourceManager::clearTextureCache() {
     std::lock_guard<std::mutex> lock(textureMutex_);
     size_t count = textureCache_.size();
     textureCache_.clear();
+    // 仍在使用的区域持有各自的页纹理，之后加载的图片打包进新的页
+    atlas_.reset();
     E2D_LOG_INFO("ResourceManager: cleared {} textures from cache", count);
 }
 
@@ -411,6 +735,7 @@ void ResourceManager::clearAllCaches() {
     clearTextureCache();
     clearFontCache();
     clearSoundCache();
+    unloadBundles();
     E2D_LOG_INFO("ResourceManager: all caches cleared");
 }
 
@@ -0,0 +1,39 @@
+#include <easy2d/resource/texture_handle.h>
+
+namespace easy2d {
+
+TextureHandle::TextureHandle(std::string path)
+    : path_(std::move(path)) {
+}
+
+Ptr<Texture> TextureHandle::getTexture() const {
+    return isReady() ? texture_ : placeholder_;
+}
+
+void TextureHandle::onLoaded(Callback callback) {
+    if (!callback) {
+        return;
+    }
+    if (isPending()) {
+        callbacks_.push_back(std::move(callback));
+    } else {
+        callback(texture_);
+    }
+}
+
+void TextureHandle::complete(Ptr<Texture> texture) {
+    if (!isPending()) {
+        return;
+    }
+    texture_ = std::move(texture);
+    state_.store(texture_ ? State::Ready : State::Failed, std::memory_order_release);
+
+    // 回调中可能再次注册回调，先取出当前列表
+    auto callbacks = std::move(callbacks_);
+    callbacks_.clear();
+    for (auto& callback : callbacks) {
+        callback(texture_);
+    }
+}
+
+} // namespace easy2d
@@ -2,7 +2,7 @@
 #include <easy2d/scene/scene.h>
 #include <easy2d/action/action.h>
 #include <easy2d/utils/logger.h>
-#include <easy2d/graphics/render_command.h>
+#include <easy2d/graphics/render_queue.h>
 #include <algorithm>
 #include <cmath>
 
@@ -10,6 +10,12 @@ namespace easy2d {
 
 Node::Node() = default;
 
+Ptr<Node> Node::create() {
+    auto node = makePtr<Node>();
+    node->setDrawsContent(false);
+    return node;
+}
+
 Node::~Node() {
     removeAllChildren();
     stopAllActions();
@@ -24,6 +30,7 @@ void Node::addChild(Ptr<Node> child) {
     child->parent_ = weak_from_this();
     children_.push_back(child);
     childrenOrderDirty_ = true;
+    onChildrenChanged();
     
     if (running_) {
         child->onEnter();
@@ -44,6 +51,7 @@ void Node::removeChild(Ptr<Node> child) {
         }
         (*it)->parent_.reset();
         children_.erase(it);
+        onChildrenChanged();
     }
 }
 
@@ -69,7 +77,10 @@ void Node::removeAllChildren() {
         }
         child->parent_.reset();
     }
-    children_.clear();
+    if (!children_.empty()) {
+        children_.clear();
+        onChildrenChanged();
+    }
 }
 
 Ptr<Node> Node::getChildByName(const std::string& name) const {
@@ -164,44 +175,48 @@ Vec2 Node::convertToNodeSpace(const Vec2& worldPos) const {
     return Vec2(localPos.x, localPos.y);
 }
 
+glm::mat4 Node::computeLocalTransform() const {
+    glm::mat4 transform(1.0f);
+
+    // T - R - S order
+    transform = glm::translate(transform, glm::vec3(position_.x, position_.y, 0.0f));
+
+    if (rotation_ != 0.0f) {
+        transform = glm::rotate(transform, rotation_ * DEG_TO_RAD, glm::vec3(0.0f, 0.0f, 1.0f));
+    }
+
+    if (skew_.x != 0.0f || skew_.y != 0.0f) {
+        glm::mat4 skewMatrix(1.0f);
+        skewMatrix[1][0] = std::tan(skew_.x * DEG_TO_RAD);
+        skewMatrix[0][1] = std::tan(skew_.y * DEG_TO_RAD);
+        transform *= skewMatrix;
+    }
+
+    transform = glm::scale(transform, glm::vec3(scale_.x, scale_.y, 1.0f));
+
+    // Apply anchor point offset
+    transform = glm::translate(transform, glm::vec3(-anchor_.x, -anchor_.y, 0.0f));
+    return transform;
+}
+
 glm::mat4 Node::getLocalTransform() const {
     if (transformDirty_) {
-        localTransform_ = glm::mat4(1.0f);
-        
-        // T - R - S order
-        localTransform_ = glm::translate(localTransform_, glm::vec3(position_.x, position_.y, 0.0f));
-        
-        if (rotation_ != 0.0f) {
-            localTransform_ = glm::rotate(localTransform_, rotation_ * DEG_TO_RAD, glm::vec3(0.0f, 0.0f, 1.0f));
-        }
-        
-        if (skew_.x != 0.0f || skew_.y != 0.0f) {
-            glm::mat4 skewMatrix(1.0f);
-            skewMatrix[1][0] = std::tan(skew_.x * DEG_TO_RAD);
-            skewMatrix[0][1] = std::tan(skew_.y * DEG_TO_RAD);
-            localTransform_ *= skewMatrix;
-        }
-        
-        localTransform_ = glm::scale(localTransform_, glm::vec3(scale_.x, scale_.y, 1.0f));
-        
-        // Apply anchor point offset
-        localTransform_ = glm::translate(localTransform_, glm::vec3(-anchor_.x, -anchor_.y, 0.0f));
-        
+        localTransform_ = computeLocalTransform();
         transformDirty_ = false;
     }
     return localTransform_;
 }
 
 glm::mat4 Node::getWorldTransform() const {
-    if (transformDirty_) {
-        worldTransform_ = getLocalTransform();
-        
-        auto p = parent_.lock();
-        if (p) {
-            worldTransform_ = p->getWorldTransform() * worldTransform_;
-        }
+    // 并行收集渲染命令时会在工作线程中调用（如 getBoundingBox），多个线程可能同时
+    // 经过同一个父节点，因此只读取已有的本地变换缓存，不写入任何成员
+    glm::mat4 world = transformDirty_ ? computeLocalTransform() : localTransform_;
+
+    auto p = parent_.lock();
+    if (p) {
+        world = p->getWorldTransform() * world;
     }
-    return worldTransform_;
+    return world;
 }
 
 void Node::onEnter() {
@@ -280,6 +295,11 @@ Rect Node::getBoundingBox() const {
     return Rect(position_.x, position_.y, 0, 0);
 }
 
+bool Node::hitTest(const Vec2& point) const {
+    Rect bounds = getBoundingBox();
+    return !bounds.empty() && bounds.containsPoint(point);
+}
+
 void Node::updateSpatialIndex() {
     if (!spatialIndexed_ || !scene_) {
         return;
@@ -330,9 +350,7 @@ void Node::update(float dt) {
 }
 
 void Node::render(RenderBackend& renderer) {
-    if (childrenOrderDirty_) {
-        sortChildren();
-    }
+    sortChildrenIfDirty();
     onRender(renderer);
 }
 
@@ -344,13 +362,44 @@ void Node::sortChildren() {
     childrenOrderDirty_ = false;
 }
 
-void Node::collectRenderCommands(std::vector<RenderCommand>& commands, int parentZOrder) {
-    // 暂时最小化实现以测试
+void Node::sortChildrenIfDirty() {
+    if (childrenOrderDirty_) {
+        sortChildren();
+    }
+}
+
+void Node::collectRenderCommands(RenderQueue& queue, int parentZOrder) {
     if (!visible_) return;
 
-    // 不排序，不递归，只生成当前节点的命令
+    sortChildrenIfDirty();
+
+    // 先生成自身的命令，再按 zOrder 顺序收集子节点，与 onRender 的绘制顺序一致
+    // 被剔除的节点不生成命令，但子节点的边界框独立，仍需继续遍历
     int accumulatedZOrder = parentZOrder + zOrder_;
-    generateRenderCommand(commands, accumulatedZOrder);
+    if (!isCulled()) {
+        generateRenderCommand(queue, accumulatedZOrder);
+    }
+
+    for (auto& child : children_) {
+        child->collectRenderCommands(queue, accumulatedZOrder);
+    }
+}
+
+bool Node::isCulled() const {
+    // 只有确实登记在空间索引中的节点才能依据查询结果剔除
+    if (!cullingEnabled_ || !spatialIndexed_ || !scene_ || lastSpatialBounds_.empty()) {
+        return false;
+    }
+    uint32_t stamp = scene_->getCullStamp();
+    return stamp != 0 && visibleStamp_ != stamp;
+}
+
+void Node::generateRenderCommand(RenderQueue& queue, int zOrder) {
+    // 未提供具体命令的节点在提交时回调 onDraw；分组节点不生成命令
+    if (!drawsContent()) {
+        return;
+    }
+    queue.push(RenderCommandType::Custom, zOrder, CustomData{ this, getBoundingBox() });
 }
 
 } // namespace easy2d
@@ -2,10 +2,15 @@
 #include <easy2d/graphics/render_backend.h>
 #include <easy2d/graphics/render_command.h>
 #include <easy2d/utils/logger.h>
+#include <easy2d/utils/thread_pool.h>
+#include <easy2d/app/application.h>
+#include <algorithm>
 
 namespace easy2d {
 
 Scene::Scene() {
+    // 场景自身不绘制内容（背景色由清屏完成）
+    setDrawsContent(false);
     defaultCamera_ = makePtr<Camera>();
 }
 
@@ -49,6 +54,38 @@ void Scene::renderContent(RenderBackend& renderer) {
     renderer.endSpriteBatch();
 }
 
+void Scene::onRender(RenderBackend& renderer) {
+    if (!isVisible()) return;
+
+    renderQueue_.clear();
+    beginCulling();
+    collectRenderCommands(renderQueue_);
+    activeCullStamp_ = 0;
+    renderQueue_.sort();
+    renderQueue_.submit(renderer);
+}
+
+// ============================================================================
+// 剔除查询 - 用相机可见区域查询空间索引，给相交的节点打上本帧标记
+// ============================================================================
+void Scene::beginCulling() {
+    activeCullStamp_ = 0;
+    Camera* camera = getActiveCamera();
+    if (!frustumCulling_ || !spatialIndexingEnabled_ || !camera) {
+        return;
+    }
+
+    if (++cullStamp_ == 0) {
+        ++cullStamp_;
+    }
+    uint32_t stamp = cullStamp_;
+    spatialManager_.query(camera->getWorldBounds(), [stamp](Node* node) {
+        node->markVisible(stamp);
+        return true;
+    });
+    activeCullStamp_ = stamp;
+}
+
 void Scene::updateScene(float dt) {
     if (!paused_) {
         update(dt);
@@ -115,11 +152,49 @@ std::vector<std::pair<Node*, Node*>> Scene::queryCollisions() const {
     return spatialManager_.queryCollisions();
 }
 
-void Scene::collectRenderCommands(std::vector<RenderCommand>& commands) {
+void Scene::collectRenderCommands(RenderQueue& queue) {
     if (!isVisible()) return;
 
+    if (parallelCollection_ && getChildren().size() > 1 &&
+        Application::instance().threadPool().getThreadCount() > 0 && !ThreadPool::isWorkerThread()) {
+        collectRenderCommandsParallel(queue);
+        return;
+    }
+
     // 从场景的子节点开始收集渲染命令
-    Node::collectRenderCommands(commands);
+    Node::collectRenderCommands(queue);
+}
+
+// ============================================================================
+// 并行收集 - 顶层子节点按顺序切成连续的块，每块写入独立队列，
+// 完成后按块顺序追加，合并结果与串行收集的绘制顺序完全一致
+// ============================================================================
+void Scene::collectRenderCommandsParallel(RenderQueue& queue) {
+    ThreadPool& pool = Application::instance().threadPool();
+
+    sortChildrenIfDirty();
+    generateRenderCommand(queue, getZOrder());
+
+    const auto& children = getChildren();
+    size_t chunkCount = std::min(children.size(), (pool.getThreadCount() + 1) * 4);
+    if (chunkQueues_.size() < chunkCount) {
+        chunkQueues_.resize(chunkCount);
+    }
+
+    int zOrder = getZOrder();
+    pool.parallelFor(chunkCount, [&](size_t chunk) {
+        size_t begin = children.size() * chunk / chunkCount;
+        size_t end = children.size() * (chunk + 1) / chunkCount;
+        RenderQueue& local = chunkQueues_[chunk];
+        local.clear();
+        for (size_t i = begin; i < end; ++i) {
+            children[i]->collectRenderCommands(local, zOrder);
+        }
+    });
+
+    for (size_t i = 0; i < chunkCount; ++i) {
+        queue.append(chunkQueues_[i]);
+    }
 }
 
 Ptr<Scene> Scene::create() {
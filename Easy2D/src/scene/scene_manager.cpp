@@ -32,8 +32,7 @@ Node* hitTestTopmost(const Ptr<Node>& node, const Vec2& worldPos) {
         return nullptr;
     }
 
-    Rect bounds = node->getBoundingBox();
-    if (!bounds.empty() && bounds.containsPoint(worldPos)) {
+    if (node->hitTest(worldPos)) {
         return node.get();
     }
 
@@ -464,15 +463,15 @@ void SceneManager::render(RenderBackend& renderer) {
     renderer.endFrame();
 }
 
-void SceneManager::collectRenderCommands(std::vector<RenderCommand>& commands) {
+void SceneManager::collectRenderCommands(RenderQueue& queue) {
     if (isTransitioning_ && outgoingScene_) {
         // During transition, collect commands from both scenes
-        outgoingScene_->collectRenderCommands(commands);
+        outgoingScene_->collectRenderCommands(queue);
         if (incomingScene_) {
-            incomingScene_->collectRenderCommands(commands);
+            incomingScene_->collectRenderCommands(queue);
         }
     } else if (!sceneStack_.empty()) {
-        sceneStack_.top()->collectRenderCommands(commands);
+        sceneStack_.top()->collectRenderCommands(queue);
     }
 }
 
@@ -523,6 +522,8 @@ void SceneManager::startTransition(Ptr<Scene> from, Ptr<Scene> to, TransitionTyp
             break;
     }
 
+    transition->setSnapshotEnabled(transitionSnapshots_);
+    transition->setIncomingLive(transitionIncomingLive_);
     transition->start(from, to);
 
     // 在过渡开始前，发送 UIHoverExit 给当前悬停的节点，重置按钮状态
@@ -1,6 +1,6 @@
 #include <easy2d/scene/shape_node.h>
 #include <easy2d/graphics/render_backend.h>
-#include <easy2d/graphics/render_command.h>
+#include <easy2d/graphics/render_queue.h>
 #include <algorithm>
 #include <cmath>
 #include <limits>
@@ -242,143 +242,88 @@ void ShapeNode::onDraw(RenderBackend& renderer) {
     }
 }
 
-void ShapeNode::generateRenderCommand(std::vector<RenderCommand>& commands, int zOrder) {
+void ShapeNode::generateRenderCommand(RenderQueue& queue, int zOrder) {
     if (points_.empty()) {
         return;
     }
 
     Vec2 offset = getPosition();
-    RenderCommand cmd;
-    cmd.zOrder = zOrder;
 
     switch (shapeType_) {
         case ShapeType::Point:
-            if (!points_.empty()) {
-                cmd.type = RenderCommandType::FilledCircle;
-                cmd.data = CircleData{
-                    points_[0] + offset,
-                    lineWidth_ * 0.5f,
-                    color_,
-                    8,
-                    0.0f
-                };
-            }
+            queue.push(RenderCommandType::FilledCircle, zOrder, CircleData{
+                points_[0] + offset,
+                lineWidth_ * 0.5f,
+                color_,
+                8,
+                0.0f
+            });
             break;
 
         case ShapeType::Line:
             if (points_.size() >= 2) {
-                cmd.type = RenderCommandType::Line;
-                cmd.data = LineData{
+                queue.push(RenderCommandType::Line, zOrder, LineData{
                     points_[0] + offset,
                     points_[1] + offset,
                     color_,
                     lineWidth_
-                };
+                });
             }
             break;
 
         case ShapeType::Rect:
             if (points_.size() >= 4) {
-                if (filled_) {
-                    cmd.type = RenderCommandType::FilledRect;
-                    Rect rect(points_[0].x, points_[0].y,
-                             points_[2].x - points_[0].x,
-                             points_[2].y - points_[0].y);
-                    cmd.data = RectData{
-                        Rect(rect.origin + offset, rect.size),
-                        color_,
-                        0.0f
-                    };
-                } else {
-                    cmd.type = RenderCommandType::Rect;
-                    Rect rect(points_[0].x, points_[0].y,
-                             points_[2].x - points_[0].x,
-                             points_[2].y - points_[0].y);
-                    cmd.data = RectData{
-                        Rect(rect.origin + offset, rect.size),
-                        color_,
-                        lineWidth_
-                    };
-                }
+                Rect rect(points_[0].x, points_[0].y,
+                         points_[2].x - points_[0].x,
+                         points_[2].y - points_[0].y);
+                queue.push(filled_ ? RenderCommandType::FilledRect : RenderCommandType::Rect, zOrder, RectData{
+                    Rect(rect.origin + offset, rect.size),
+                    color_,
+                    filled_ ? 0.0f : lineWidth_
+                });
             }
             break;
 
         case ShapeType::Circle:
             if (points_.size() >= 2) {
-                float radius = points_[1].x;
-                if (filled_) {
-                    cmd.type = RenderCommandType::FilledCircle;
-                    cmd.data = CircleData{
-                        points_[0] + offset,
-                        radius,
-                        color_,
-                        segments_,
-                        0.0f
-                    };
-                } else {
-                    cmd.type = RenderCommandType::Circle;
-                    cmd.data = CircleData{
-                        points_[0] + offset,
-                        radius,
-                        color_,
-                        segments_,
-                        lineWidth_
-                    };
-                }
+                queue.push(filled_ ? RenderCommandType::FilledCircle : RenderCommandType::Circle, zOrder, CircleData{
+                    points_[0] + offset,
+                    points_[1].x,
+                    color_,
+                    segments_,
+                    filled_ ? 0.0f : lineWidth_
+                });
             }
             break;
 
         case ShapeType::Triangle:
             if (points_.size() >= 3) {
-                Vec2 p1 = points_[0] + offset;
-                Vec2 p2 = points_[1] + offset;
-                Vec2 p3 = points_[2] + offset;
-                if (filled_) {
-                    cmd.type = RenderCommandType::FilledTriangle;
-                    cmd.data = TriangleData{
-                        p1, p2, p3,
-                        color_,
-                        0.0f
-                    };
-                } else {
-                    cmd.type = RenderCommandType::Triangle;
-                    cmd.data = TriangleData{
-                        p1, p2, p3,
-                        color_,
-                        lineWidth_
-                    };
-                }
+                queue.push(filled_ ? RenderCommandType::FilledTriangle : RenderCommandType::Triangle, zOrder, TriangleData{
+                    points_[0] + offset,
+                    points_[1] + offset,
+                    points_[2] + offset,
+                    color_,
+                    filled_ ? 0.0f : lineWidth_
+                });
             }
             break;
 
-        case ShapeType::Polygon:
-            if (!points_.empty()) {
-                std::vector<Vec2> transformedPoints;
-                transformedPoints.reserve(points_.size());
-                for (const auto& p : points_) {
-                    transformedPoints.push_back(p + offset);
-                }
-
-                if (filled_) {
-                    cmd.type = RenderCommandType::FilledPolygon;
-                    cmd.data = PolygonData{
-                        transformedPoints,
-                        color_,
-                        0.0f
-                    };
-                } else {
-                    cmd.type = RenderCommandType::Polygon;
-                    cmd.data = PolygonData{
-                        transformedPoints,
-                        color_,
-                        lineWidth_
-                    };
-                }
+        case ShapeType::Polygon: {
+            // 顶点直接写入队列内存池
+            uint32_t pointOffset = 0;
+            Vec2* points = queue.allocatePoints(points_.size(), pointOffset);
+            for (size_t i = 0; i < points_.size(); ++i) {
+                points[i] = points_[i] + offset;
             }
+            queue.push(filled_ ? RenderCommandType::FilledPolygon : RenderCommandType::Polygon, zOrder, PolygonData{
+                pointOffset,
+                static_cast<uint32_t>(points_.size()),
+                color_,
+                filled_ ? 0.0f : lineWidth_
+            });
             break;
+        }
     }
-
-    commands.push_back(std::move(cmd));
 }
 
 } // namespace easy2d
@@ -1,7 +1,7 @@
 #include <easy2d/scene/sprite.h>
 #include <easy2d/graphics/render_backend.h>
 #include <easy2d/graphics/texture.h>
-#include <easy2d/graphics/render_command.h>
+#include <easy2d/graphics/render_queue.h>
 #include <algorithm>
 #include <cmath>
 
@@ -76,25 +76,25 @@ Rect Sprite::getBoundingBox() const {
     return Rect(l, t, std::abs(w), std::abs(h));
 }
 
-void Sprite::onDraw(RenderBackend& renderer) {
+bool Sprite::getDrawRects(Rect& destRect, Rect& srcRect) const {
     if (!texture_ || !texture_->isValid()) {
-        return;
+        return false;
     }
-    
-    // Calculate destination rectangle based on texture rect
+
+    // 根据纹理矩形计算目标矩形
     float width = textureRect_.width();
     float height = textureRect_.height();
-    
+
     auto pos = getPosition();
     auto anchor = getAnchor();
     auto scale = getScale();
-    Rect destRect(pos.x - width * anchor.x * scale.x, 
-                  pos.y - height * anchor.y * scale.y,
-                  width * scale.x, 
-                  height * scale.y);
-    
-    // Adjust source rect for flipping
-    Rect srcRect = textureRect_;
+    destRect = Rect(pos.x - width * anchor.x * scale.x,
+                    pos.y - height * anchor.y * scale.y,
+                    width * scale.x,
+                    height * scale.y);
+
+    // 调整源矩形（翻转）
+    srcRect = textureRect_;
     if (flipX_) {
         srcRect.origin.x = srcRect.right();
         srcRect.size.width = -srcRect.size.width;
@@ -103,52 +103,36 @@ void Sprite::onDraw(RenderBackend& renderer) {
         srcRect.origin.y = srcRect.bottom();
         srcRect.size.height = -srcRect.size.height;
     }
-    
-    renderer.drawSprite(*texture_, destRect, srcRect, color_, getRotation(), getAnchor());
+    return true;
 }
 
-void Sprite::generateRenderCommand(std::vector<RenderCommand>& commands, int zOrder) {
-    if (!texture_ || !texture_->isValid()) {
+void Sprite::onDraw(RenderBackend& renderer) {
+    Rect destRect;
+    Rect srcRect;
+    if (!getDrawRects(destRect, srcRect)) {
         return;
     }
+    renderer.drawSprite(*texture_, destRect, srcRect, color_, getRotation(), getAnchor());
+}
 
-    // 计算目标矩形（与 onDraw 一致）
-    float width = textureRect_.width();
-    float height = textureRect_.height();
-
-    auto pos = getPosition();
-    auto anchor = getAnchor();
-    auto scale = getScale();
-    Rect destRect(pos.x - width * anchor.x * scale.x,
-                  pos.y - height * anchor.y * scale.y,
-                  width * scale.x,
-                  height * scale.y);
-
-    // 调整源矩形（翻转）
-    Rect srcRect = textureRect_;
-    if (flipX_) {
-        srcRect.origin.x = srcRect.right();
-        srcRect.size.width = -srcRect.size.width;
-    }
-    if (flipY_) {
-        srcRect.origin.y = srcRect.bottom();
-        srcRect.size.height = -srcRect.size.height;
+void Sprite::generateRenderCommand(RenderQueue& queue, int zOrder) {
+    Rect destRect;
+    Rect srcRect;
+    if (!getDrawRects(destRect, srcRect)) {
+        return;
     }
 
+    // 图集区域直接以页纹理提交，使同一页中的精灵排序后相邻、合入同一批次
+    srcRect.origin += texture_->getSourceOffset();
+
     // 创建渲染命令
-    RenderCommand cmd;
-    cmd.type = RenderCommandType::Sprite;
-    cmd.zOrder = zOrder;
-    cmd.data = SpriteData{
-        texture_,
+    queue.push(RenderCommandType::Sprite, zOrder, SpriteData{
         destRect,
         srcRect,
         color_,
         getRotation(),
-        anchor
-    };
-
-    commands.push_back(std::move(cmd));
+        getAnchor()
+    }, &texture_->getSourceTexture());
 }
 
 } // namespace easy2d
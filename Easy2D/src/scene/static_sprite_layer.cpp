@@ -0,0 +1,136 @@
+#include <easy2d/scene/static_sprite_layer.h>
+#include <easy2d/scene/sprite.h>
+#include <easy2d/graphics/render_backend.h>
+#include <easy2d/graphics/render_queue.h>
+
+namespace easy2d {
+
+StaticSpriteLayer::StaticSpriteLayer() = default;
+
+Ptr<StaticSpriteLayer> StaticSpriteLayer::create() {
+    return makePtr<StaticSpriteLayer>();
+}
+
+size_t StaticSpriteLayer::getBakedSpriteCount() const {
+    return buffer_ ? buffer_->getSpriteCount() : 0;
+}
+
+Rect StaticSpriteLayer::getBoundingBox() const {
+    return bounds_;
+}
+
+void StaticSpriteLayer::onChildrenChanged() {
+    childrenDirty_ = true;
+    bakeDirty_ = true;
+}
+
+// ============================================================================
+// 整理子节点：精灵子节点交给烘焙，其余节点（以及带子节点的精灵）记录下来每帧遍历
+// ============================================================================
+void StaticSpriteLayer::refreshChildren() {
+    if (!childrenDirty_) return;
+    childrenDirty_ = false;
+
+    sortChildrenIfDirty();
+    dynamicChildren_.clear();
+    for (const auto& child : getChildren()) {
+        bool baked = dynamic_cast<Sprite*>(child.get()) != nullptr;
+        if (!baked || !child->getChildren().empty()) {
+            dynamicChildren_.push_back(DynamicChild{ child.get(), baked });
+        }
+    }
+}
+
+void StaticSpriteLayer::bake(RenderBackend& renderer) {
+    bakeDirty_ = false;
+
+    sortChildrenIfDirty();
+    sprites_.clear();
+    textures_.clear();
+    bounds_ = Rect();
+
+    for (const auto& child : getChildren()) {
+        auto* sprite = dynamic_cast<Sprite*>(child.get());
+        if (!sprite || !sprite->isVisible()) continue;
+
+        StaticSprite data;
+        if (!sprite->getDrawRects(data.destRect, data.srcRect)) continue;
+
+        Ptr<Texture> texture = sprite->getTexture();
+        data.texture = texture.get();
+        data.tint = sprite->getColor();
+        data.rotation = sprite->getRotation();
+        data.anchor = sprite->getAnchor();
+        sprites_.push_back(data);
+        bounds_ = bounds_.unionWith(sprite->getBoundingBox());
+
+        if (textures_.empty() || textures_.back() != texture) {
+            textures_.push_back(std::move(texture));
+        }
+    }
+
+    if (!buffer_) {
+        buffer_ = renderer.createStaticSpriteBuffer();
+    }
+    if (buffer_) {
+        buffer_->build(sprites_);
+    }
+    sprites_.clear();
+
+    updateSpatialIndex();
+}
+
+void StaticSpriteLayer::onDraw(RenderBackend& renderer) {
+    if (bakeDirty_) {
+        bake(renderer);
+    }
+    if (buffer_) {
+        // 烘焙时已使用各精灵的最终位置
+        renderer.drawStaticSprites(*buffer_, glm::mat4(1.0f));
+    }
+}
+
+void StaticSpriteLayer::onRender(RenderBackend& renderer) {
+    if (!isVisible()) return;
+
+    refreshChildren();
+    onDraw(renderer);
+
+    for (const auto& child : dynamicChildren_) {
+        if (child.baked) {
+            if (!child.node->isVisible()) continue;
+            for (const auto& grandChild : child.node->getChildren()) {
+                grandChild->onRender(renderer);
+            }
+        } else {
+            child.node->onRender(renderer);
+        }
+    }
+}
+
+void StaticSpriteLayer::collectRenderCommands(RenderQueue& queue, int parentZOrder) {
+    if (!isVisible()) return;
+
+    refreshChildren();
+
+    // 已烘焙的精灵由自身的一条命令整体绘制，不再逐个生成命令
+    int accumulatedZOrder = parentZOrder + getZOrder();
+    if (!isCulled()) {
+        generateRenderCommand(queue, accumulatedZOrder);
+    }
+
+    for (const auto& child : dynamicChildren_) {
+        if (child.baked) {
+            if (!child.node->isVisible()) continue;
+            child.node->sortChildrenIfDirty();
+            int childZOrder = accumulatedZOrder + child.node->getZOrder();
+            for (const auto& grandChild : child.node->getChildren()) {
+                grandChild->collectRenderCommands(queue, childZOrder);
+            }
+        } else {
+            child.node->collectRenderCommands(queue, accumulatedZOrder);
+        }
+    }
+}
+
+} // namespace easy2d
@@ -1,6 +1,6 @@
 #include <easy2d/scene/text.h>
 #include <easy2d/graphics/render_backend.h>
-#include <easy2d/graphics/render_command.h>
+#include <easy2d/graphics/render_queue.h>
 
 namespace easy2d {
 
@@ -55,11 +55,13 @@ float Text::getLineHeight() const {
 }
 
 void Text::updateCache() const {
-    if (!sizeDirty_ || !font_) {
+    if (!font_ || !isCacheDirty()) {
         return;
     }
     
-    cachedSize_ = font_->measureText(text_);
+    // 排版同时得到尺寸，不再单独测量
+    run_.build(*font_, text_);
+    cachedSize_ = run_.getSize();
     sizeDirty_ = false;
 }
 
@@ -107,10 +109,12 @@ void Text::onDraw(RenderBackend& renderer) {
     }
     
     Vec2 pos = getPosition();
+
+    // 始终在主线程刷新尺寸缓存，供之后的并行命令收集使用
+    Vec2 size = getTextSize();
     
     // Calculate horizontal offset based on alignment
     if (alignment_ != Alignment::Left) {
-        Vec2 size = getTextSize();
         if (alignment_ == Alignment::Center) {
             pos.x -= size.x * 0.5f;
         } else if (alignment_ == Alignment::Right) {
@@ -118,19 +122,32 @@ void Text::onDraw(RenderBackend& renderer) {
         }
     }
 
-    renderer.drawText(*font_, text_, pos, color_);
+    renderer.drawGlyphRun(run_, pos, color_);
 }
 
-void Text::generateRenderCommand(std::vector<RenderCommand>& commands, int zOrder) {
+void Text::generateRenderCommand(RenderQueue& queue, int zOrder) {
     if (!font_ || text_.empty()) {
         return;
     }
 
+    // 排版缓存失效时重建可能光栅化新字形、压缩图集页（GL 调用并改变图集代数），
+    // 改为生成自定义命令，提交时由主线程回调 onDraw。并行收集时调用线程也参与
+    // 生成命令，任何线程都不在收集期间重建，工作线程读到的图集状态保持不变
+    if (isCacheDirty()) {
+        queue.push(RenderCommandType::Custom, zOrder, CustomData{ this, Rect() });
+        return;
+    }
+
+    // 没有可见字形时无需绘制
+    if (run_.empty()) {
+        return;
+    }
+
     Vec2 pos = getPosition();
+    Vec2 size = cachedSize_;
 
     // 计算对齐偏移（与 onDraw 一致）
     if (alignment_ != Alignment::Left) {
-        Vec2 size = getTextSize();
         if (alignment_ == Alignment::Center) {
             pos.x -= size.x * 0.5f;
         } else if (alignment_ == Alignment::Right) {
@@ -138,18 +155,17 @@ void Text::generateRenderCommand(std::vector<RenderCommand>& commands, int zOrde
         }
     }
 
-    // 创建渲染命令
-    RenderCommand cmd;
-    cmd.type = RenderCommandType::Text;
-    cmd.zOrder = zOrder;
-    cmd.data = TextData{
-        font_,
-        text_,
+    // 创建渲染命令（排版结果与字体由节点持有，提交前保持有效）
+    // 按首个字形所在的图集页排序，与相邻文字合批；纹理取自构建时记录的页，不访问图集
+    const Texture* texture = run_.getQuads().front().texture;
+    queue.push(RenderCommandType::Text, zOrder, TextData{
+        font_.get(),
+        &text_,
+        &run_,
         pos,
-        color_
-    };
-
-    commands.push_back(std::move(cmd));
+        color_,
+        size
+    }, texture);
 }
 
 } // namespace easy2d
@@ -0,0 +1,223 @@
+#include <easy2d/scene/tile_map.h>
+#include <easy2d/scene/scene.h>
+#include <easy2d/graphics/camera.h>
+#include <easy2d/graphics/render_backend.h>
+#include <easy2d/graphics/texture.h>
+#include <easy2d/utils/logger.h>
+#include <algorithm>
+#include <cmath>
+
+namespace easy2d {
+
+TileMap::TileMap(Ptr<Texture> tileset, const Size& tileSize, int width, int height)
+    : tileset_(std::move(tileset))
+    , tileSize_(tileSize)
+    , width_(std::max(width, 0))
+    , height_(std::max(height, 0))
+    , columns_(0)
+    , tileCount_(0) {
+    tiles_.assign(static_cast<size_t>(width_) * height_, EMPTY_TILE);
+
+    chunkColumns_ = (width_ + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunkRows_ = (height_ + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunks_.resize(static_cast<size_t>(chunkColumns_) * chunkRows_);
+
+    updateTilesetLayout();
+    setAnchor(0.0f, 0.0f);
+}
+
+Ptr<TileMap> TileMap::create(Ptr<Texture> tileset, const Size& tileSize, int width, int height) {
+    return makePtr<TileMap>(std::move(tileset), tileSize, width, height);
+}
+
+// ============================================================================
+// 瓦片
+// ============================================================================
+void TileMap::setTile(int x, int y, TileId id) {
+    if (x < 0 || y < 0 || x >= width_ || y >= height_) return;
+
+    TileId& tile = tiles_[static_cast<size_t>(y) * width_ + x];
+    if (tile == id) return;
+    tile = id;
+    chunks_[static_cast<size_t>(y / CHUNK_SIZE) * chunkColumns_ + x / CHUNK_SIZE].dirty = true;
+}
+
+TileMap::TileId TileMap::getTile(int x, int y) const {
+    if (x < 0 || y < 0 || x >= width_ || y >= height_) return EMPTY_TILE;
+    return tiles_[static_cast<size_t>(y) * width_ + x];
+}
+
+void TileMap::fill(TileId id) {
+    std::fill(tiles_.begin(), tiles_.end(), id);
+    markAllChunksDirty();
+}
+
+void TileMap::setTiles(const std::vector<TileId>& tiles) {
+    if (tiles.size() != tiles_.size()) {
+        E2D_LOG_WARN("TileMap::setTiles: expected {} tiles, got {}", tiles_.size(), tiles.size());
+        return;
+    }
+    tiles_ = tiles;
+    markAllChunksDirty();
+}
+
+bool TileMap::worldToTile(const Vec2& pos, int& x, int& y) const {
+    if (tileSize_.empty()) return false;
+    Vec2 local = convertToNodeSpace(pos);
+    x = static_cast<int>(std::floor(local.x / tileSize_.width));
+    y = static_cast<int>(std::floor(local.y / tileSize_.height));
+    return x >= 0 && y >= 0 && x < width_ && y < height_;
+}
+
+Vec2 TileMap::tileToWorld(int x, int y) const {
+    return convertToWorldSpace(Vec2(x * tileSize_.width, y * tileSize_.height));
+}
+
+// ============================================================================
+// 图块集
+// ============================================================================
+void TileMap::setTileset(Ptr<Texture> tileset) {
+    tileset_ = std::move(tileset);
+    updateTilesetLayout();
+    markAllChunksDirty();
+}
+
+void TileMap::updateTilesetLayout() {
+    columns_ = 0;
+    tileCount_ = 0;
+    if (tileset_ && tileSize_.width > 0.0f && tileSize_.height > 0.0f) {
+        columns_ = static_cast<int>(tileset_->getWidth() / tileSize_.width);
+        tileCount_ = columns_ * static_cast<int>(tileset_->getHeight() / tileSize_.height);
+    }
+}
+
+void TileMap::markAllChunksDirty() {
+    for (auto& chunk : chunks_) {
+        chunk.dirty = true;
+    }
+}
+
+Rect TileMap::getBoundingBox() const {
+    // 地图四角变换到世界空间后的包围盒
+    float w = width_ * tileSize_.width;
+    float h = height_ * tileSize_.height;
+    const Vec2 corners[4] = {
+        convertToWorldSpace(Vec2(0.0f, 0.0f)),
+        convertToWorldSpace(Vec2(w, 0.0f)),
+        convertToWorldSpace(Vec2(0.0f, h)),
+        convertToWorldSpace(Vec2(w, h))
+    };
+    Vec2 minPos = corners[0];
+    Vec2 maxPos = corners[0];
+    for (const Vec2& corner : corners) {
+        minPos = Vec2(std::min(minPos.x, corner.x), std::min(minPos.y, corner.y));
+        maxPos = Vec2(std::max(maxPos.x, corner.x), std::max(maxPos.y, corner.y));
+    }
+    return Rect(minPos.x, minPos.y, maxPos.x - minPos.x, maxPos.y - minPos.y);
+}
+
+// ============================================================================
+// 渲染
+// ============================================================================
+void TileMap::rebuildChunk(RenderBackend& renderer, int chunkX, int chunkY, Chunk& chunk) {
+    chunk.dirty = false;
+
+    scratch_.clear();
+    if (columns_ > 0) {
+        int x0 = chunkX * CHUNK_SIZE;
+        int y0 = chunkY * CHUNK_SIZE;
+        int x1 = std::min(x0 + CHUNK_SIZE, width_);
+        int y1 = std::min(y0 + CHUNK_SIZE, height_);
+
+        for (int y = y0; y < y1; ++y) {
+            const TileId* row = &tiles_[static_cast<size_t>(y) * width_];
+            for (int x = x0; x < x1; ++x) {
+                TileId id = row[x];
+                if (id == EMPTY_TILE) continue;
+
+                // 图块集换小后残留的 ID 跳过，不采样到图块集之外
+                int index = id - 1;
+                if (index >= tileCount_) continue;
+
+                StaticSprite sprite;
+                sprite.texture = tileset_.get();
+                sprite.destRect = Rect((x - x0) * tileSize_.width, (y - y0) * tileSize_.height,
+                                       tileSize_.width, tileSize_.height);
+                sprite.srcRect = Rect((index % columns_) * tileSize_.width, (index / columns_) * tileSize_.height,
+                                      tileSize_.width, tileSize_.height);
+                scratch_.push_back(sprite);
+            }
+        }
+    }
+
+    // 空块不创建缓冲区
+    if (scratch_.empty() && !chunk.buffer) return;
+    if (!chunk.buffer) {
+        chunk.buffer = renderer.createStaticSpriteBuffer();
+        if (!chunk.buffer) return;
+    }
+    chunk.buffer->build(scratch_);
+}
+
+void TileMap::onDraw(RenderBackend& renderer) {
+    visibleChunks_ = 0;
+    if (!tileset_ || !tileset_->isValid() || chunks_.empty() || tileSize_.empty()) {
+        return;
+    }
+
+    // 缩放为 0 时不可见，变换也无法求逆
+    glm::mat4 world = getWorldTransform();
+    if (glm::determinant(world) == 0.0f) {
+        return;
+    }
+    float chunkW = CHUNK_SIZE * tileSize_.width;
+    float chunkH = CHUNK_SIZE * tileSize_.height;
+
+    // 默认提交全部块；有相机时只提交与可见区域相交的块
+    int cx0 = 0;
+    int cy0 = 0;
+    int cx1 = chunkColumns_ - 1;
+    int cy1 = chunkRows_ - 1;
+
+    Scene* scene = getScene();
+    Camera* camera = scene ? scene->getActiveCamera() : nullptr;
+    if (camera) {
+        // 可见区域的四角变换到节点空间，取包围盒（节点旋转时略大于实际可见范围）
+        Rect view = camera->getWorldBounds();
+        glm::mat4 inverse = glm::inverse(world);
+        const glm::vec4 corners[4] = {
+            inverse * glm::vec4(view.left(), view.top(), 0.0f, 1.0f),
+            inverse * glm::vec4(view.right(), view.top(), 0.0f, 1.0f),
+            inverse * glm::vec4(view.left(), view.bottom(), 0.0f, 1.0f),
+            inverse * glm::vec4(view.right(), view.bottom(), 0.0f, 1.0f)
+        };
+        float minX = corners[0].x, minY = corners[0].y;
+        float maxX = corners[0].x, maxY = corners[0].y;
+        for (const glm::vec4& corner : corners) {
+            minX = std::min(minX, corner.x);
+            minY = std::min(minY, corner.y);
+            maxX = std::max(maxX, corner.x);
+            maxY = std::max(maxY, corner.y);
+        }
+        cx0 = std::max(cx0, static_cast<int>(std::floor(minX / chunkW)));
+        cy0 = std::max(cy0, static_cast<int>(std::floor(minY / chunkH)));
+        cx1 = std::min(cx1, static_cast<int>(std::floor(maxX / chunkW)));
+        cy1 = std::min(cy1, static_cast<int>(std::floor(maxY / chunkH)));
+    }
+
+    for (int cy = cy0; cy <= cy1; ++cy) {
+        for (int cx = cx0; cx <= cx1; ++cx) {
+            Chunk& chunk = chunks_[static_cast<size_t>(cy) * chunkColumns_ + cx];
+            if (chunk.dirty) {
+                rebuildChunk(renderer, cx, cy, chunk);
+            }
+            if (chunk.buffer && chunk.buffer->getSpriteCount() > 0) {
+                glm::mat4 transform = glm::translate(world, glm::vec3(cx * chunkW, cy * chunkH, 0.0f));
+                renderer.drawStaticSprites(*chunk.buffer, transform);
+                visibleChunks_++;
+            }
+        }
+    }
+}
+
+} // namespace easy2d
@@ -1,9 +1,12 @@
 #include <easy2d/scene/transition.h>
 #include <easy2d/graphics/render_backend.h>
+#include <easy2d/graphics/render_target.h>
+#include <easy2d/graphics/texture.h>
 #include <easy2d/graphics/camera.h>
 #include <easy2d/core/math_types.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <algorithm>
+#include <cmath>
 
 namespace easy2d {
 
@@ -26,7 +29,10 @@ Transition::Transition(float duration)
     , elapsed_(0.0f)
     , progress_(0.0f)
     , isFinished_(false)
-    , isStarted_(false) {
+    , isStarted_(false)
+    , snapshotEnabled_(true)
+    , incomingLive_(false)
+    , snapshotsTaken_(false) {
 }
 
 void Transition::start(Ptr<Scene> from, Ptr<Scene> to) {
@@ -36,6 +42,9 @@ void Transition::start(Ptr<Scene> from, Ptr<Scene> to) {
     progress_ = 0.0f;
     isFinished_ = false;
     isStarted_ = true;
+    outgoingSnapshot_.reset();
+    incomingSnapshot_.reset();
+    snapshotsTaken_ = false;
 }
 
 void Transition::update(float dt) {
@@ -58,9 +67,77 @@ void Transition::render(RenderBackend& renderer) {
         return;
     }
     
+    if (snapshotEnabled_) {
+        updateSnapshots(renderer);
+    }
     onRenderTransition(renderer, easeInOutQuad(progress_));
 }
 
+// ============================================================================
+// 场景快照 - 以首帧画面代替每帧的完整渲染；栈顶场景仍会更新，
+// 需要显示动态内容时关闭快照或让入场场景保持实时渲染（setIncomingLive）
+// ============================================================================
+void Transition::updateSnapshots(RenderBackend& renderer) {
+    if (!snapshotsTaken_) {
+        snapshotsTaken_ = true;
+        if (outgoingScene_) {
+            outgoingSnapshot_ = captureScene(renderer, *outgoingScene_, nullptr);
+        }
+        if (incomingScene_) {
+            incomingSnapshot_ = captureScene(renderer, *incomingScene_, nullptr);
+        }
+    } else if (incomingLive_ && incomingScene_ && incomingSnapshot_) {
+        captureScene(renderer, *incomingScene_, incomingSnapshot_);
+    }
+}
+
+Ptr<RenderTarget> Transition::captureScene(RenderBackend& renderer, Scene& scene, Ptr<RenderTarget> target) {
+    if (!target) {
+        Size screen = getScreenSize();
+        target = renderer.createRenderTarget(static_cast<int>(std::ceil(screen.width)),
+                                             static_cast<int>(std::ceil(screen.height)));
+        if (!target) {
+            return nullptr;
+        }
+    }
+
+    Ptr<RenderTarget> previous = renderer.getRenderTarget();
+    renderer.setRenderTarget(target);
+    // 目标保持不透明，快照按普通纹理混合时内容不会变淡
+    Color background = scene.getBackgroundColor();
+    background.a = 1.0f;
+    renderer.clear(background);
+    scene.renderContent(renderer);
+    renderer.setRenderTarget(previous);
+    return target;
+}
+
+void Transition::drawSnapshot(RenderBackend& renderer, const RenderTarget& snapshot, const Vec2& center,
+                              const Size& size, float alpha, float rotation) {
+    Ptr<Texture> texture = snapshot.getTexture();
+    if (!texture || size.width <= 0.0f || size.height <= 0.0f) {
+        return;
+    }
+
+    Size screen = getScreenSize();
+    renderer.setViewProjection(glm::ortho(0.0f, screen.width, screen.height, 0.0f, -1.0f, 1.0f));
+    Rect srcRect(0.0f, 0.0f, static_cast<float>(texture->getWidth()), static_cast<float>(texture->getHeight()));
+    renderer.drawSprite(*texture, Rect(center.x, center.y, size.width, size.height), srcRect,
+                        Color(1.0f, 1.0f, 1.0f, alpha), rotation, Vec2(0.5f, 0.5f));
+}
+
+Size Transition::getScreenSize() const {
+    for (const auto& scene : { outgoingScene_, incomingScene_ }) {
+        if (scene) {
+            Size viewportSize = scene->getViewportSize();
+            if (viewportSize.width > 0 && viewportSize.height > 0) {
+                return viewportSize;
+            }
+        }
+    }
+    return Size(800.0f, 600.0f);
+}
+
 float Transition::getFadeInAlpha() const {
     return easeOutQuad(progress_);
 }
@@ -71,6 +148,8 @@ float Transition::getFadeOutAlpha() const {
 
 void Transition::onFinish() {
     isFinished_ = true;
+    outgoingSnapshot_.reset();
+    incomingSnapshot_.reset();
     if (finishCallback_) {
         finishCallback_();
     }
@@ -84,39 +163,28 @@ FadeTransition::FadeTransition(float duration)
 }
 
 void FadeTransition::onRenderTransition(RenderBackend& renderer, float progress) {
-    float screenWidth = 800.0f;
-    float screenHeight = 600.0f;
-
-    if (outgoingScene_) {
-        Size viewportSize = outgoingScene_->getViewportSize();
-        if (viewportSize.width > 0 && viewportSize.height > 0) {
-            screenWidth = viewportSize.width;
-            screenHeight = viewportSize.height;
-        }
-    } else if (incomingScene_) {
-        Size viewportSize = incomingScene_->getViewportSize();
-        if (viewportSize.width > 0 && viewportSize.height > 0) {
-            screenWidth = viewportSize.width;
-            screenHeight = viewportSize.height;
-        }
-    }
-
-    glm::mat4 overlayVP = glm::ortho(0.0f, screenWidth, screenHeight, 0.0f, -1.0f, 1.0f);
+    Size screen = getScreenSize();
+    Vec2 center(screen.width * 0.5f, screen.height * 0.5f);
+    glm::mat4 overlayVP = glm::ortho(0.0f, screen.width, screen.height, 0.0f, -1.0f, 1.0f);
 
     if (progress < 0.5f) {
-        if (outgoingScene_) {
+        if (auto* snapshot = getOutgoingSnapshot()) {
+            drawSnapshot(renderer, *snapshot, center, screen);
+        } else if (outgoingScene_) {
             outgoingScene_->renderContent(renderer);
         }
         float a = std::clamp(progress * 2.0f, 0.0f, 1.0f);
         renderer.setViewProjection(overlayVP);
-        renderer.fillRect(Rect(0.0f, 0.0f, screenWidth, screenHeight), Color(0.0f, 0.0f, 0.0f, a));
+        renderer.fillRect(Rect(0.0f, 0.0f, screen.width, screen.height), Color(0.0f, 0.0f, 0.0f, a));
     } else {
-        if (incomingScene_) {
+        if (auto* snapshot = getIncomingSnapshot()) {
+            drawSnapshot(renderer, *snapshot, center, screen);
+        } else if (incomingScene_) {
             incomingScene_->renderContent(renderer);
         }
         float a = std::clamp((1.0f - progress) * 2.0f, 0.0f, 1.0f);
         renderer.setViewProjection(overlayVP);
-        renderer.fillRect(Rect(0.0f, 0.0f, screenWidth, screenHeight), Color(0.0f, 0.0f, 0.0f, a));
+        renderer.fillRect(Rect(0.0f, 0.0f, screen.width, screen.height), Color(0.0f, 0.0f, 0.0f, a));
     }
 }
 
@@ -130,22 +198,10 @@ SlideTransition::SlideTransition(float duration, TransitionDirection direction)
 
 void SlideTransition::onRenderTransition(RenderBackend& renderer, float progress) {
     // 获取视口尺寸
-    float screenWidth = 800.0f;
-    float screenHeight = 600.0f;
-    
-    if (outgoingScene_) {
-        Size viewportSize = outgoingScene_->getViewportSize();
-        if (viewportSize.width > 0 && viewportSize.height > 0) {
-            screenWidth = viewportSize.width;
-            screenHeight = viewportSize.height;
-        }
-    } else if (incomingScene_) {
-        Size viewportSize = incomingScene_->getViewportSize();
-        if (viewportSize.width > 0 && viewportSize.height > 0) {
-            screenWidth = viewportSize.width;
-            screenHeight = viewportSize.height;
-        }
-    }
+    Size screen = getScreenSize();
+    float screenWidth = screen.width;
+    float screenHeight = screen.height;
+    Vec2 center(screenWidth * 0.5f, screenHeight * 0.5f);
     
     // 渲染源场景（滑出）
     if (outgoingScene_) {
@@ -167,21 +223,25 @@ void SlideTransition::onRenderTransition(RenderBackend& renderer, float progress
                 break;
         }
         
-        // 保存原始相机位置
-        Camera* camera = outgoingScene_->getActiveCamera();
-        Vec2 originalPos = camera ? camera->getPosition() : Vec2::Zero();
-        
-        // 应用偏移
-        if (camera) {
-            camera->setPosition(originalPos.x + offsetX, originalPos.y + offsetY);
-        }
-        
-        // 渲染场景
-        outgoingScene_->renderContent(renderer);
-        
-        // 恢复相机位置
-        if (camera) {
-            camera->setPosition(originalPos);
+        if (auto* snapshot = getOutgoingSnapshot()) {
+            drawSnapshot(renderer, *snapshot, Vec2(center.x + offsetX, center.y + offsetY), screen);
+        } else {
+            // 保存原始相机位置
+            Camera* camera = outgoingScene_->getActiveCamera();
+            Vec2 originalPos = camera ? camera->getPosition() : Vec2::Zero();
+            
+            // 应用偏移
+            if (camera) {
+                camera->setPosition(originalPos.x + offsetX, originalPos.y + offsetY);
+            }
+            
+            // 渲染场景
+            outgoingScene_->renderContent(renderer);
+            
+            // 恢复相机位置
+            if (camera) {
+                camera->setPosition(originalPos);
+            }
         }
     }
     
@@ -205,21 +265,25 @@ void SlideTransition::onRenderTransition(RenderBackend& renderer, float progress
                 break;
         }
         
-        // 保存原始相机位置
-        Camera* camera = incomingScene_->getActiveCamera();
-        Vec2 originalPos = camera ? camera->getPosition() : Vec2::Zero();
-        
-        // 应用偏移
-        if (camera) {
-            camera->setPosition(originalPos.x + offsetX, originalPos.y + offsetY);
-        }
-        
-        // 渲染场景
-        incomingScene_->renderContent(renderer);
-        
-        // 恢复相机位置
-        if (camera) {
-            camera->setPosition(originalPos);
+        if (auto* snapshot = getIncomingSnapshot()) {
+            drawSnapshot(renderer, *snapshot, Vec2(center.x + offsetX, center.y + offsetY), screen);
+        } else {
+            // 保存原始相机位置
+            Camera* camera = incomingScene_->getActiveCamera();
+            Vec2 originalPos = camera ? camera->getPosition() : Vec2::Zero();
+            
+            // 应用偏移
+            if (camera) {
+                camera->setPosition(originalPos.x + offsetX, originalPos.y + offsetY);
+            }
+            
+            // 渲染场景
+            incomingScene_->renderContent(renderer);
+            
+            // 恢复相机位置
+            if (camera) {
+                camera->setPosition(originalPos);
+            }
         }
     }
 }
@@ -232,86 +296,24 @@ ScaleTransition::ScaleTransition(float duration)
 }
 
 void ScaleTransition::onRenderTransition(RenderBackend& renderer, float progress) {
+    Size screen = getScreenSize();
+    Vec2 center(screen.width * 0.5f, screen.height * 0.5f);
+
     // 源场景：缩小消失
     if (outgoingScene_) {
         float scale = std::max(0.01f, 1.0f - progress);
         
-        // 保存原始相机状态
-        Camera* camera = outgoingScene_->getActiveCamera();
-        float originalZoom = camera ? camera->getZoom() : 1.0f;
-        Vec2 originalPos = camera ? camera->getPosition() : Vec2::Zero();
-        
-        // 应用缩放（通过调整相机 zoom 实现）
-        if (camera) {
-            camera->setZoom(originalZoom * scale);
-        }
-        
-        // 渲染场景
-        outgoingScene_->renderContent(renderer);
-        
-        // 恢复相机状态
-        if (camera) {
-            camera->setZoom(originalZoom);
-            camera->setPosition(originalPos);
-        }
-    }
-    
-    // 目标场景：放大出现
-    if (incomingScene_) {
-        float scale = std::max(0.01f, progress);
-        
-        // 保存原始相机状态
-        Camera* camera = incomingScene_->getActiveCamera();
-        float originalZoom = camera ? camera->getZoom() : 1.0f;
-        Vec2 originalPos = camera ? camera->getPosition() : Vec2::Zero();
-        
-        // 应用缩放
-        if (camera) {
-            camera->setZoom(originalZoom * scale);
-        }
-        
-        // 渲染场景
-        incomingScene_->renderContent(renderer);
-        
-        // 恢复相机状态
-        if (camera) {
-            camera->setZoom(originalZoom);
-            camera->setPosition(originalPos);
-        }
-    }
-}
-
-// ============================================================================
-// FlipTransition - 翻页
-// ============================================================================
-FlipTransition::FlipTransition(float duration, Axis axis)
-    : Transition(duration)
-    , axis_(axis) {
-}
-
-void FlipTransition::onRenderTransition(RenderBackend& renderer, float progress) {
-    float angle = progress * PI_F; // 180度翻转
-    
-    if (progress < 0.5f) {
-        // 前半段：翻转源场景
-        if (outgoingScene_) {
-            float currentAngle = angle;
-            
+        if (auto* snapshot = getOutgoingSnapshot()) {
+            drawSnapshot(renderer, *snapshot, center, Size(screen.width * scale, screen.height * scale));
+        } else {
             // 保存原始相机状态
             Camera* camera = outgoingScene_->getActiveCamera();
-            float originalRotation = camera ? camera->getRotation() : 0.0f;
+            float originalZoom = camera ? camera->getZoom() : 1.0f;
+            Vec2 originalPos = camera ? camera->getPosition() : Vec2::Zero();
             
-            // 应用旋转（水平翻转绕Y轴，垂直翻转绕X轴）
-            if (axis_ == Axis::Horizontal) {
-                // 水平轴翻转 - 模拟绕X轴旋转
-                if (camera) {
-                    camera->setRotation(originalRotation + currentAngle * RAD_TO_DEG);
-                }
-            } else {
-                // 垂直轴翻转 - 模拟绕Y轴旋转
-                if (camera) {
-                    camera->setRotation(originalRotation - currentAngle * RAD_TO_DEG);
-                }
+            // 应用缩放（通过调整相机 zoom 实现）
+            if (camera) {
+                camera->setZoom(originalZoom * scale);
             }
             
             // 渲染场景
@@ -319,27 +321,27 @@ void FlipTransition::onRenderTransition(RenderBackend& renderer, float progress)
             
             // 恢复相机状态
             if (camera) {
-                camera->setRotation(originalRotation);
+                camera->setZoom(originalZoom);
+                camera->setPosition(originalPos);
             }
         }
-    } else {
-        // 后半段：翻转目标场景
-        if (incomingScene_) {
-            float currentAngle = angle - PI_F;
-            
+    }
+    
+    // 目标场景：放大出现
+    if (incomingScene_) {
+        float scale = std::max(0.01f, progress);
+        
+        if (auto* snapshot = getIncomingSnapshot()) {
+            drawSnapshot(renderer, *snapshot, center, Size(screen.width * scale, screen.height * scale));
+        } else {
             // 保存原始相机状态
             Camera* camera = incomingScene_->getActiveCamera();
-            float originalRotation = camera ? camera->getRotation() : 0.0f;
+            float originalZoom = camera ? camera->getZoom() : 1.0f;
+            Vec2 originalPos = camera ? camera->getPosition() : Vec2::Zero();
             
-            // 应用旋转
-            if (axis_ == Axis::Horizontal) {
-                if (camera) {
-                    camera->setRotation(originalRotation + currentAngle * RAD_TO_DEG);
-                }
-            } else {
-                if (camera) {
-                    camera->setRotation(originalRotation - currentAngle * RAD_TO_DEG);
-                }
+            // 应用缩放
+            if (camera) {
+                camera->setZoom(originalZoom * scale);
             }
             
             // 渲染场景
@@ -347,12 +349,65 @@ void FlipTransition::onRenderTransition(RenderBackend& renderer, float progress)
             
             // 恢复相机状态
             if (camera) {
-                camera->setRotation(originalRotation);
+                camera->setZoom(originalZoom);
+                camera->setPosition(originalPos);
             }
         }
     }
 }
 
+// ============================================================================
+// FlipTransition - 翻页
+// ============================================================================
+FlipTransition::FlipTransition(float duration, Axis axis)
+    : Transition(duration)
+    , axis_(axis) {
+}
+
+void FlipTransition::onRenderTransition(RenderBackend& renderer, float progress) {
+    float angle = progress * PI_F; // 180度翻转
+    bool firstHalf = progress < 0.5f;
+    Ptr<Scene> scene = firstHalf ? outgoingScene_ : incomingScene_;
+    if (!scene) {
+        return;
+    }
+    float currentAngle = firstHalf ? angle : angle - PI_F;
+
+    // 快照：按旋转角的余弦压缩画面，模拟绕轴翻转
+    const RenderTarget* snapshot = firstHalf ? getOutgoingSnapshot() : getIncomingSnapshot();
+    if (snapshot) {
+        Size screen = getScreenSize();
+        float squash = std::abs(std::cos(currentAngle));
+        Size size = axis_ == Axis::Horizontal ? Size(screen.width, screen.height * squash)
+                                              : Size(screen.width * squash, screen.height);
+        drawSnapshot(renderer, *snapshot, Vec2(screen.width * 0.5f, screen.height * 0.5f), size);
+        return;
+    }
+
+    // 保存原始相机状态
+    Camera* camera = scene->getActiveCamera();
+    float originalRotation = camera ? camera->getRotation() : 0.0f;
+    
+    // 应用旋转（水平翻转绕Y轴，垂直翻转绕X轴）
+    if (camera) {
+        if (axis_ == Axis::Horizontal) {
+            // 水平轴翻转 - 模拟绕X轴旋转
+            camera->setRotation(originalRotation + currentAngle * RAD_TO_DEG);
+        } else {
+            // 垂直轴翻转 - 模拟绕Y轴旋转
+            camera->setRotation(originalRotation - currentAngle * RAD_TO_DEG);
+        }
+    }
+    
+    // 渲染场景
+    scene->renderContent(renderer);
+    
+    // 恢复相机状态
+    if (camera) {
+        camera->setRotation(originalRotation);
+    }
+}
+
 // ============================================================================
 // BoxTransition - 方块过渡
 // ============================================================================
@@ -362,24 +417,14 @@ BoxTransition::BoxTransition(float duration, int divisions)
 }
 
 void BoxTransition::onRenderTransition(RenderBackend& renderer, float progress) {
-    float screenWidth = 800.0f;
-    float screenHeight = 600.0f;
+    Size screen = getScreenSize();
+    float screenWidth = screen.width;
+    float screenHeight = screen.height;
 
-    if (incomingScene_) {
-        Size viewportSize = incomingScene_->getViewportSize();
-        if (viewportSize.width > 0 && viewportSize.height > 0) {
-            screenWidth = viewportSize.width;
-            screenHeight = viewportSize.height;
-        }
-    } else if (outgoingScene_) {
-        Size viewportSize = outgoingScene_->getViewportSize();
-        if (viewportSize.width > 0 && viewportSize.height > 0) {
-            screenWidth = viewportSize.width;
-            screenHeight = viewportSize.height;
-        }
-    }
-
-    if (incomingScene_) {
+    const RenderTarget* snapshot = incomingScene_ ? getIncomingSnapshot() : getOutgoingSnapshot();
+    if (snapshot) {
+        drawSnapshot(renderer, *snapshot, Vec2(screenWidth * 0.5f, screenHeight * 0.5f), screen);
+    } else if (incomingScene_) {
         incomingScene_->renderContent(renderer);
     } else if (outgoingScene_) {
         outgoingScene_->renderContent(renderer);
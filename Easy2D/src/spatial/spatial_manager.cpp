@@ -2,6 +2,7 @@
 #include <easy2d/spatial/quadtree.h>
 #include <easy2d/spatial/spatial_hash.h>
 #include <easy2d/scene/node.h>
+#include <algorithm>
 #include <chrono>
 
 namespace easy2d {
@@ -33,8 +34,9 @@ void SpatialManager::setAutoThresholds(size_t quadTreeThreshold, size_t hashThre
 }
 
 void SpatialManager::setWorldBounds(const Rect& bounds) {
+    Rect previousBounds = worldBounds_;
     worldBounds_ = bounds;
-    rebuild();
+    rebuildIndex(previousBounds);
 }
 
 void SpatialManager::insert(Node* node, const Rect& bounds) {
@@ -42,6 +44,7 @@ void SpatialManager::insert(Node* node, const Rect& bounds) {
         selectOptimalStrategy();
     }
     
+    ensureContains(bounds);
     if (index_) {
         index_->insert(node, bounds);
     }
@@ -54,6 +57,7 @@ void SpatialManager::remove(Node* node) {
 }
 
 void SpatialManager::update(Node* node, const Rect& newBounds) {
+    ensureContains(newBounds);
     if (index_) {
         index_->update(node, newBounds);
     }
@@ -111,26 +115,55 @@ bool SpatialManager::empty() const {
 }
 
 void SpatialManager::rebuild() {
+    rebuildIndex(worldBounds_);
+}
+
+void SpatialManager::rebuildIndex(const Rect& previousBounds) {
     if (!index_) {
         selectOptimalStrategy();
         return;
     }
     
-    auto oldIndex = std::move(index_);
+    // 用旧边界查询旧索引，否则缩小世界边界时会丢失旧边界内、新边界外的对象
+    auto objects = index_->query(previousBounds.unionWith(worldBounds_));
+    for (Node* node : objects) {
+        if (node) {
+            worldBounds_ = worldBounds_.unionWith(node->getBoundingBox());
+        }
+    }
+    
+    // 在替换旧索引前选择策略，使自动策略能参考当前对象数量
     selectOptimalStrategy();
     
-    if (index_ && oldIndex) {
-        auto bounds = Rect(worldBounds_);
-        auto objects = oldIndex->query(bounds);
+    if (index_) {
         for (Node* node : objects) {
             if (node) {
-                auto nodeBounds = node->getBoundingBox();
-                index_->insert(node, nodeBounds);
+                index_->insert(node, node->getBoundingBox());
             }
         }
     }
 }
 
+// ============================================================================
+// 世界边界扩展 - 四叉树会丢弃根节点范围外的对象，对象超出时按余量扩大并重建
+// ============================================================================
+void SpatialManager::ensureContains(const Rect& bounds) {
+    if (bounds.empty() || worldBounds_.contains(bounds)) {
+        return;
+    }
+    
+    Rect previousBounds = worldBounds_;
+    Rect grown = worldBounds_.unionWith(bounds);
+    float margin = std::max(grown.size.width, grown.size.height) * 0.5f;
+    worldBounds_ = Rect(grown.origin.x - margin, grown.origin.y - margin,
+                        grown.size.width + margin * 2.0f, grown.size.height + margin * 2.0f);
+    
+    // 空间哈希没有边界限制，只需记录新的世界边界
+    if (activeStrategy_ == SpatialStrategy::QuadTree) {
+        rebuildIndex(previousBounds);
+    }
+}
+
 void SpatialManager::optimize() {
     if (currentStrategy_ == SpatialStrategy::Auto) {
         selectOptimalStrategy();
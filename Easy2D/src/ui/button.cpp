@@ -1,5 +1,6 @@
 #include <easy2d/ui/button.h>
 #include <easy2d/graphics/render_backend.h>
+#include <easy2d/graphics/alpha_mask.h>
 #include <easy2d/app/application.h>
 #include <algorithm>
 #include <cmath>
@@ -48,8 +49,9 @@ Ptr<Button> Button::create() {
  */
 void Button::setText(const String& text) {
     text_ = text;
+    textRun_.invalidate();
     if (font_ && getSize().empty()) {
-        Vec2 textSize = font_->measureText(text_);
+        Vec2 textSize = getTextRun().getSize();
         setSize(textSize.x + padding_.x * 2.0f, textSize.y + padding_.y * 2.0f);
     }
 }
@@ -60,8 +62,9 @@ void Button::setText(const String& text) {
  */
 void Button::setFont(Ptr<FontAtlas> font) {
     font_ = font;
+    textRun_.invalidate();
     if (font_ && getSize().empty() && !text_.empty()) {
-        Vec2 textSize = font_->measureText(text_);
+        Vec2 textSize = getTextRun().getSize();
         setSize(textSize.x + padding_.x * 2.0f, textSize.y + padding_.y * 2.0f);
     }
 }
@@ -73,7 +76,7 @@ void Button::setFont(Ptr<FontAtlas> font) {
 void Button::setPadding(const Vec2& padding) {
     padding_ = padding;
     if (font_ && getSize().empty() && !text_.empty()) {
-        Vec2 textSize = font_->measureText(text_);
+        Vec2 textSize = getTextRun().getSize();
         setSize(textSize.x + padding_.x * 2.0f, textSize.y + padding_.y * 2.0f);
     }
 }
@@ -86,6 +89,17 @@ void Button::setTextColor(const Color& color) {
     textColor_ = color;
 }
 
+/**
+ * @brief 获取文字排版缓存，文字、字体变化或图集移动字形后在此重建
+ * @return 排版后的字形串
+ */
+const GlyphRun& Button::getTextRun() const {
+    if (font_ && !textRun_.isValid(*font_)) {
+        textRun_.build(*font_, text_);
+    }
+    return textRun_;
+}
+
 /**
  * @brief 设置纯色背景的颜色状态
  * @param normal 正常状态颜色
@@ -201,7 +215,7 @@ void Button::setCustomSize(float width, float height) {
  * @param imageSize 图片原始尺寸
  * @return 计算后的绘制尺寸
  */
-Vec2 Button::calculateImageSize(const Vec2& buttonSize, const Vec2& imageSize) {
+Vec2 Button::calculateImageSize(const Vec2& buttonSize, const Vec2& imageSize) const {
     switch (scaleMode_) {
         case ImageScaleMode::Original:
             return imageSize;
@@ -226,6 +240,61 @@ Vec2 Button::calculateImageSize(const Vec2& buttonSize, const Vec2& imageSize) {
     return imageSize;
 }
 
+/**
+ * @brief 获取点击检测使用的图片（普通状态图片）及其绘制区域
+ * @param texture 输出图片
+ * @param imageRect 输出绘制区域
+ * @return 是否有可用的图片
+ */
+bool Button::getHitTestImage(const Texture*& texture, Rect& imageRect) const {
+    if (!useImageBackground_ || !imgNormal_) {
+        return false;
+    }
+
+    Rect rect = getBoundingBox();
+    Vec2 imageSize(static_cast<float>(imgNormal_->getWidth()), static_cast<float>(imgNormal_->getHeight()));
+    Vec2 drawSize = calculateImageSize(Vec2(rect.size.width, rect.size.height), imageSize);
+    imageRect = Rect(rect.origin.x + (rect.size.width - drawSize.x) * 0.5f,
+                     rect.origin.y + (rect.size.height - drawSize.y) * 0.5f,
+                     drawSize.x, drawSize.y);
+    texture = imgNormal_.get();
+    return true;
+}
+
+/**
+ * @brief 点击检测
+ * 
+ * 先判断边界框；启用 Alpha 遮罩点击检测时再把点映射到图片像素，
+ * 由遮罩判断是否落在不透明区域。图片没有遮罩时退回边界框检测。
+ * @param point 世界坐标
+ * @return 是否命中
+ */
+bool Button::hitTest(const Vec2& point) const {
+    if (!Widget::hitTest(point)) {
+        return false;
+    }
+    if (!useAlphaMaskForHitTest_) {
+        return true;
+    }
+
+    const Texture* texture = nullptr;
+    Rect imageRect;
+    if (!getHitTestImage(texture, imageRect)) {
+        return true;
+    }
+    const AlphaMask* mask = texture->getAlphaMask();
+    if (!mask || !mask->isValid()) {
+        return true;
+    }
+    if (imageRect.empty() || !imageRect.containsPoint(point)) {
+        return false;
+    }
+
+    int x = static_cast<int>((point.x - imageRect.origin.x) / imageRect.size.width * mask->getWidth());
+    int y = static_cast<int>((point.y - imageRect.origin.y) / imageRect.size.height * mask->getHeight());
+    return mask->isOpaque(x, y);
+}
+
 /**
  * @brief 绘制背景图片，根据当前状态选择对应的图片
  * @param renderer 渲染后端
@@ -422,8 +491,7 @@ void Button::fillRoundedRect(RenderBackend& renderer, const Rect& rect, const Co
  * 3. 文字 - 最顶层
  * 
  * 注意：此方法在场景渲染的精灵批次中被调用。
- * 由于 fillRect 和 drawRect 使用形状渲染管线（与精灵批次不同），
- * 需要在调用它们之前结束精灵批次，然后在 drawText 之前重新开始。
+ * 形状与精灵、文字共用同一批次，按调用顺序绘制，无需打断批次。
  */
 void Button::onDraw(RenderBackend& renderer) {
     Rect rect = getBoundingBox();
@@ -437,8 +505,6 @@ void Button::onDraw(RenderBackend& renderer) {
         drawBackgroundImage(renderer, rect);
     } else {
         // 纯色背景使用 fillRect 或 fillRoundedRect 绘制
-        renderer.endSpriteBatch();
-        
         Color bg = bgNormal_;
         if (pressed_) {
             bg = bgPressed_;
@@ -451,13 +517,9 @@ void Button::onDraw(RenderBackend& renderer) {
         } else {
             renderer.fillRect(rect, bg);
         }
-        
-        renderer.beginSpriteBatch();
     }
 
     // ========== 第2层：绘制边框 ==========
-    renderer.endSpriteBatch();
-    
     if (borderWidth_ > 0.0f) {
         if (roundedCornersEnabled_) {
             drawRoundedRect(renderer, rect, borderColor_, cornerRadius_);
@@ -465,12 +527,11 @@ void Button::onDraw(RenderBackend& renderer) {
             renderer.drawRect(rect, borderColor_, borderWidth_);
         }
     }
-    
-    renderer.beginSpriteBatch();
 
     // ========== 第3层：绘制文字 ==========
     if (font_ && !text_.empty()) {
-        Vec2 textSize = font_->measureText(text_);
+        const GlyphRun& run = getTextRun();
+        Vec2 textSize = run.getSize();
         
         Vec2 textPos(
             rect.center().x - textSize.x * 0.5f,
@@ -488,7 +549,7 @@ void Button::onDraw(RenderBackend& renderer) {
         Color finalTextColor = textColor_;
         finalTextColor.a = 1.0f;
         
-        renderer.drawText(*font_, text_, textPos, finalTextColor);
+        renderer.drawGlyphRun(run, textPos, finalTextColor);
     }
 }
 
@@ -574,6 +635,8 @@ void ToggleImageButton::setOnStateChange(Function<void(bool)> callback) {
 void ToggleImageButton::setStateText(const String& textOff, const String& textOn) {
     textOff_ = textOff;
     textOn_ = textOn;
+    textRunOff_.invalidate();
+    textRunOn_.invalidate();
     useStateText_ = true;
 }
 
@@ -588,6 +651,28 @@ void ToggleImageButton::setStateTextColor(const Color& colorOff, const Color& co
     useStateTextColor_ = true;
 }
 
+/**
+ * @brief 获取点击检测使用的图片（当前状态的普通图片，按原尺寸居中绘制）
+ * @param texture 输出图片
+ * @param imageRect 输出绘制区域
+ * @return 是否有可用的图片
+ */
+bool ToggleImageButton::getHitTestImage(const Texture*& texture, Rect& imageRect) const {
+    const Ptr<Texture>& image = isOn_ ? imgOnNormal_ : imgOffNormal_;
+    if (!image) {
+        return false;
+    }
+
+    Rect rect = getBoundingBox();
+    float width = static_cast<float>(image->getWidth());
+    float height = static_cast<float>(image->getHeight());
+    imageRect = Rect(rect.origin.x + (rect.size.width - width) * 0.5f,
+                     rect.origin.y + (rect.size.height - height) * 0.5f,
+                     width, height);
+    texture = image.get();
+    return true;
+}
+
 /**
  * @brief 切换按钮绘制主函数
  * 
@@ -638,8 +723,6 @@ void ToggleImageButton::onDraw(RenderBackend& renderer) {
     }
 
     // ========== 第2层：绘制边框 ==========
-    renderer.endSpriteBatch();
-    
     float borderWidth = 1.0f;
     Color borderColor = isOn_ ? Color(0.0f, 1.0f, 0.0f, 0.8f) : Color(0.6f, 0.6f, 0.6f, 1.0f);
     if (borderWidth > 0.0f) {
@@ -649,17 +732,23 @@ void ToggleImageButton::onDraw(RenderBackend& renderer) {
             renderer.drawRect(rect, borderColor, borderWidth);
         }
     }
-    
-    renderer.beginSpriteBatch();
 
     // ========== 第3层：绘制状态文字 ==========
     auto font = getFont();
     if (font) {
-        String textToDraw;
+        // 当前状态的文字排版（状态文字各自缓存，不必每帧复制字符串）
+        const GlyphRun* run = nullptr;
         if (useStateText_) {
-            textToDraw = isOn_ ? textOn_ : textOff_;
-        } else {
-            textToDraw = getText();
+            const String& text = isOn_ ? textOn_ : textOff_;
+            GlyphRun& stateRun = isOn_ ? textRunOn_ : textRunOff_;
+            if (!text.empty()) {
+                if (!stateRun.isValid(*font)) {
+                    stateRun.build(*font, text);
+                }
+                run = &stateRun;
+            }
+        } else if (!getText().empty()) {
+            run = &getTextRun();
         }
 
         Color colorToUse;
@@ -669,13 +758,13 @@ void ToggleImageButton::onDraw(RenderBackend& renderer) {
             colorToUse = getTextColor();
         }
 
-        if (!textToDraw.empty()) {
-            Vec2 textSize = font->measureText(textToDraw);
+        if (run) {
+            Vec2 textSize = run->getSize();
             Vec2 textPos(rect.center().x - textSize.x * 0.5f, rect.center().y - textSize.y * 0.5f);
             
             colorToUse.a = 1.0f;
             
-            renderer.drawText(*font, textToDraw, textPos, colorToUse);
+            renderer.drawGlyphRun(*run, textPos, colorToUse);
         }
     }
 }
@@ -0,0 +1,119 @@
+#include <easy2d/utils/thread_pool.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace easy2d {
+
+static thread_local bool tlsIsWorker = false;
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    workers_.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void ThreadPool::submit(Task task) {
+    if (workers_.empty()) {
+        task();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    condition_.notify_one();
+}
+
+// ============================================================================
+// 并行循环 - 各线程从共享计数器领取下标，最后一个完成者唤醒调用线程
+// ============================================================================
+void ThreadPool::parallelFor(size_t count, const Function<void(size_t)>& task) {
+    if (count == 0) return;
+    if (count == 1 || workers_.empty() || tlsIsWorker) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    // 共享状态由提交的任务持有，调用线程返回后仍在排队的任务只会看到已领完的计数器
+    struct Job {
+        const Function<void(size_t)>* task;
+        size_t count;
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto job = std::make_shared<Job>();
+    job->task = &task;
+    job->count = count;
+
+    auto run = [](Job& j) {
+        size_t i;
+        while ((i = j.next.fetch_add(1)) < j.count) {
+            (*j.task)(i);
+            if (j.done.fetch_add(1) + 1 == j.count) {
+                std::lock_guard<std::mutex> lock(j.mutex);
+                j.finished.notify_all();
+            }
+        }
+    };
+
+    size_t helpers = std::min(workers_.size(), count - 1);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < helpers; ++i) {
+            tasks_.push_back([job, run]() { run(*job); });
+        }
+    }
+    condition_.notify_all();
+
+    run(*job);
+
+    std::unique_lock<std::mutex> lock(job->mutex);
+    job->finished.wait(lock, [&job]() { return job->done.load() == job->count; });
+}
+
+bool ThreadPool::isWorkerThread() {
+    return tlsIsWorker;
+}
+
+size_t ThreadPool::getDefaultThreadCount() {
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware > 1 ? hardware - 1 : 0;
+}
+
+void ThreadPool::workerLoop() {
+    tlsIsWorker = true;
+    while (true) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+            if (stopping_ && tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace easy2d
@@ -0,0 +1,528 @@
+// ============================================================================
+// easy2d_cook - 离线资源烘焙工具
+//
+// 把图片打包成图集页、把字体预光栅化，输出 AssetBundle 可直接内存映射加载的
+// 二进制资源包（格式见 easy2d/resource/asset_bundle_format.h）
+//
+// 用法：
+//   easy2d_cook -o <输出文件> [选项] <图片或目录>...
+//
+// 选项：
+//   --root <目录>          资源名相对的根目录（默认当前目录），
+//                          应与运行时 loadTexture / loadFont 传入的路径一致
+//   --page-size <N>        图片图集页尺寸（默认 2048），超过的图片单独成页
+//   --font <文件>:<字号>[:sdf]
+//                          预光栅化字体，可重复
+//   --font-page-size <N>   字体图集页尺寸（默认 512）
+//   --chars <文件>         额外烘焙的字符（UTF-8 文本），默认只包含可打印 ASCII
+// ============================================================================
+
+#include <easy2d/core/string.h>
+#include <easy2d/resource/asset_bundle_format.h>
+#include <stb/stb_image.h>
+#include <stb/stb_rect_pack.h>
+#include <stb/stb_truetype.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace easy2d;
+
+namespace {
+
+constexpr int PADDING = 2;
+
+struct Options {
+    std::string output;
+    fs::path root = ".";
+    int pageSize = 2048;
+    int fontPageSize = 512;
+    std::vector<std::string> inputs;
+    std::vector<std::string> fonts;
+    std::string charsFile;
+};
+
+struct Image {
+    std::string name;
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;    // RGBA
+    uint32_t page = 0;
+    int x = 0;
+    int y = 0;
+};
+
+struct Page {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    bundle::PixelFormat format = bundle::PixelFormat::RGBA8;
+    std::vector<uint8_t> pixels;
+};
+
+struct Font {
+    std::string name;
+    int fontSize = 0;
+    bool useSDF = false;
+    uint32_t page = 0;
+    float ascent = 0.0f;
+    float descent = 0.0f;
+    float lineGap = 0.0f;
+    std::vector<bundle::GlyphEntry> glyphs;
+};
+
+void printUsage() {
+    std::fprintf(stderr,
+                 "usage: easy2d_cook -o <bundle> [--root <dir>] [--page-size N]\n"
+                 "                   [--font <file>:<size>[:sdf]]... [--font-page-size N]\n"
+                 "                   [--chars <utf8 file>] <image or directory>...\n");
+}
+
+bool parseArgs(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+
+        const char* value = nullptr;
+        if (arg == "-o" || arg == "--output") {
+            if (!(value = next())) return false;
+            options.output = value;
+        } else if (arg == "--root") {
+            if (!(value = next())) return false;
+            options.root = value;
+        } else if (arg == "--page-size") {
+            if (!(value = next())) return false;
+            options.pageSize = std::atoi(value);
+        } else if (arg == "--font-page-size") {
+            if (!(value = next())) return false;
+            options.fontPageSize = std::atoi(value);
+        } else if (arg == "--font") {
+            if (!(value = next())) return false;
+            options.fonts.push_back(value);
+        } else if (arg == "--chars") {
+            if (!(value = next())) return false;
+            options.charsFile = value;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::fprintf(stderr, "unknown option: %s\n", arg.c_str());
+            return false;
+        } else {
+            options.inputs.push_back(arg);
+        }
+    }
+    return !options.output.empty() && options.pageSize > PADDING * 2 && options.fontPageSize > PADDING * 2;
+}
+
+// 资源名：相对 root 的路径，统一使用 '/'；不在 root 下的文件保持原样
+std::string makeName(const fs::path& file, const fs::path& root) {
+    std::error_code ec;
+    fs::path relative = fs::relative(file, root, ec);
+    if (ec || relative.empty() || *relative.begin() == "..") {
+        relative = file;
+    }
+    return relative.generic_string();
+}
+
+bool isImageFile(const fs::path& file) {
+    std::string ext = file.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+    return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".gif" ||
+           ext == ".bmp" || ext == ".tga";
+}
+
+// ============================================================================
+// 图片
+// ============================================================================
+bool loadImages(const Options& options, std::vector<Image>& images) {
+    std::vector<fs::path> files;
+    for (const auto& input : options.inputs) {
+        if (fs::is_directory(input)) {
+            for (const auto& entry : fs::recursive_directory_iterator(input)) {
+                if (entry.is_regular_file() && isImageFile(entry.path())) {
+                    files.push_back(entry.path());
+                }
+            }
+        } else {
+            files.push_back(input);
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    stbi_set_flip_vertically_on_load(false);
+    for (const auto& file : files) {
+        Image image;
+        int channels = 0;
+        uint8_t* data = stbi_load(file.string().c_str(), &image.width, &image.height, &channels, 4);
+        if (!data) {
+            std::fprintf(stderr, "failed to load image: %s\n", file.string().c_str());
+            return false;
+        }
+        image.name = makeName(file, options.root);
+        image.pixels.assign(data, data + static_cast<size_t>(image.width) * image.height * 4);
+        stbi_image_free(data);
+        images.push_back(std::move(image));
+    }
+    return true;
+}
+
+// 把图片打包进若干页：先按高度排序，每页一次性打包剩余的全部图片，
+// 放不下的留给下一页；超过页尺寸的图片单独成页
+void packImages(const Options& options, std::vector<Image>& images, std::vector<Page>& pages) {
+    std::vector<Image*> pending;
+    for (auto& image : images) {
+        if (image.width + PADDING * 2 > options.pageSize || image.height + PADDING * 2 > options.pageSize) {
+            image.page = static_cast<uint32_t>(pages.size());
+            image.x = 0;
+            image.y = 0;
+            Page page;
+            page.width = static_cast<uint32_t>(image.width);
+            page.height = static_cast<uint32_t>(image.height);
+            page.pixels = image.pixels;
+            pages.push_back(std::move(page));
+        } else {
+            pending.push_back(&image);
+        }
+    }
+    std::sort(pending.begin(), pending.end(), [](const Image* a, const Image* b) {
+        return a->height > b->height;
+    });
+
+    std::vector<stbrp_node> nodes(options.pageSize);
+    while (!pending.empty()) {
+        stbrp_context context;
+        stbrp_init_target(&context, options.pageSize, options.pageSize, nodes.data(), options.pageSize);
+
+        std::vector<stbrp_rect> rects(pending.size());
+        for (size_t i = 0; i < pending.size(); ++i) {
+            rects[i].id = static_cast<int>(i);
+            rects[i].w = pending[i]->width + PADDING * 2;
+            rects[i].h = pending[i]->height + PADDING * 2;
+        }
+        stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size()));
+
+        uint32_t pageIndex = static_cast<uint32_t>(pages.size());
+        Page page;
+        page.width = static_cast<uint32_t>(options.pageSize);
+        page.height = static_cast<uint32_t>(options.pageSize);
+        page.pixels.assign(static_cast<size_t>(options.pageSize) * options.pageSize * 4, 0);
+
+        std::vector<Image*> remaining;
+        for (const auto& rect : rects) {
+            Image* image = pending[rect.id];
+            if (!rect.was_packed) {
+                remaining.push_back(image);
+                continue;
+            }
+            image->page = pageIndex;
+            image->x = rect.x + PADDING;
+            image->y = rect.y + PADDING;
+
+            // 与运行时图集一致：图片第 0 行写入页的第 y 行（glTexImage2D 行序）
+            size_t rowBytes = static_cast<size_t>(image->width) * 4;
+            for (int row = 0; row < image->height; ++row) {
+                std::memcpy(&page.pixels[(static_cast<size_t>(image->y + row) * page.width + image->x) * 4],
+                            &image->pixels[row * rowBytes], rowBytes);
+            }
+        }
+        pages.push_back(std::move(page));
+        pending.swap(remaining);
+    }
+}
+
+// ============================================================================
+// 字体
+// ============================================================================
+std::vector<char32_t> makeCharset(const Options& options) {
+    std::set<char32_t> charset;
+    for (char32_t c = 32; c < 127; ++c) {
+        charset.insert(c);
+    }
+    if (!options.charsFile.empty()) {
+        std::ifstream file(options.charsFile, std::ios::binary);
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        for (char32_t c : String::fromUtf8(text).toUtf32()) {
+            if (c >= 32) charset.insert(c);
+        }
+    }
+    return std::vector<char32_t>(charset.begin(), charset.end());
+}
+
+bool parseFontSpec(const std::string& spec, std::string& file, int& fontSize, bool& useSDF) {
+    useSDF = false;
+    size_t colon = spec.rfind(':');
+    if (colon == std::string::npos) return false;
+
+    std::string last = spec.substr(colon + 1);
+    std::string rest = spec.substr(0, colon);
+    if (last == "sdf") {
+        useSDF = true;
+        colon = rest.rfind(':');
+        if (colon == std::string::npos) return false;
+        last = rest.substr(colon + 1);
+        rest = rest.substr(0, colon);
+    }
+    file = rest;
+    fontSize = std::atoi(last.c_str());
+    return !file.empty() && fontSize > 0;
+}
+
+// 光栅化一个字体到新的一页，字形布局和纹理坐标与 GLFontAtlas 完全一致
+bool bakeFont(const Options& options, const std::string& spec, const std::vector<char32_t>& charset,
+              std::vector<Page>& pages, Font& font) {
+    std::string file;
+    if (!parseFontSpec(spec, file, font.fontSize, font.useSDF)) {
+        std::fprintf(stderr, "invalid font spec: %s\n", spec.c_str());
+        return false;
+    }
+
+    std::ifstream stream(file, std::ios::binary);
+    std::vector<unsigned char> fontData((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    stbtt_fontinfo info;
+    if (fontData.empty() || !stbtt_InitFont(&info, fontData.data(), stbtt_GetFontOffsetForIndex(fontData.data(), 0))) {
+        std::fprintf(stderr, "failed to load font: %s\n", file.c_str());
+        return false;
+    }
+
+    float scale = stbtt_ScaleForPixelHeight(&info, static_cast<float>(font.fontSize));
+    int ascent = 0, descent = 0, lineGap = 0;
+    stbtt_GetFontVMetrics(&info, &ascent, &descent, &lineGap);
+    font.name = makeName(file, options.root);
+    font.ascent = ascent * scale;
+    font.descent = descent * scale;
+    font.lineGap = lineGap * scale;
+
+    const int size = options.fontPageSize;
+    const int channels = font.useSDF ? 1 : 4;
+    font.page = static_cast<uint32_t>(pages.size());
+    Page page;
+    page.width = static_cast<uint32_t>(size);
+    page.height = static_cast<uint32_t>(size);
+    page.format = font.useSDF ? bundle::PixelFormat::R8 : bundle::PixelFormat::RGBA8;
+    page.pixels.assign(static_cast<size_t>(size) * size * channels, 0);
+
+    std::vector<stbrp_node> nodes(size);
+    stbrp_context context;
+    stbrp_init_target(&context, size, size, nodes.data(), size);
+
+    for (char32_t codepoint : charset) {
+        int glyphIndex = stbtt_FindGlyphIndex(&info, static_cast<int>(codepoint));
+        if (glyphIndex == 0 && codepoint != ' ') continue;
+
+        int advance = 0;
+        stbtt_GetCodepointHMetrics(&info, static_cast<int>(codepoint), &advance, nullptr);
+
+        bundle::GlyphEntry glyph{};
+        glyph.codepoint = static_cast<uint32_t>(codepoint);
+        glyph.advance = advance * scale;
+
+        int w = 0, h = 0, xoff = 0, yoff = 0;
+        unsigned char* bitmap = nullptr;
+        if (font.useSDF) {
+            bitmap = stbtt_GetCodepointSDF(&info, scale, static_cast<int>(codepoint), 8, 128, 64.0f,
+                                           &w, &h, &xoff, &yoff);
+        } else {
+            bitmap = stbtt_GetCodepointBitmap(&info, scale, scale, static_cast<int>(codepoint),
+                                              &w, &h, &xoff, &yoff);
+        }
+        auto freeBitmap = [&]() {
+            if (!bitmap) return;
+            if (font.useSDF) {
+                stbtt_FreeSDF(bitmap, nullptr);
+            } else {
+                stbtt_FreeBitmap(bitmap, nullptr);
+            }
+        };
+        if (!bitmap || w <= 0 || h <= 0) {
+            freeBitmap();
+            font.glyphs.push_back(glyph);
+            continue;
+        }
+
+        stbrp_rect rect;
+        rect.id = 0;
+        rect.w = w + PADDING * 2;
+        rect.h = h + PADDING * 2;
+        stbrp_pack_rects(&context, &rect, 1);
+        if (!rect.was_packed) {
+            std::fprintf(stderr, "font page is full, glyph U+%04X skipped (%s)\n",
+                         static_cast<unsigned>(codepoint), spec.c_str());
+            freeBitmap();
+            continue;
+        }
+
+        int atlasX = rect.x + PADDING;
+        int atlasY = rect.y + PADDING;
+        glyph.width = static_cast<float>(w);
+        glyph.height = static_cast<float>(h);
+        glyph.bearingX = static_cast<float>(xoff);
+        glyph.bearingY = static_cast<float>(yoff);
+        glyph.u0 = static_cast<float>(atlasX) / size;
+        glyph.v0 = 1.0f - static_cast<float>(atlasY + h) / size;
+        glyph.u1 = static_cast<float>(atlasX + w) / size;
+        glyph.v1 = 1.0f - static_cast<float>(atlasY) / size;
+        font.glyphs.push_back(glyph);
+
+        // GLFontAtlas 把字形上传到 GL 的第 (size - atlasY - h) 行起，这里按相同位置写入
+        int baseRow = size - atlasY - h;
+        for (int row = 0; row < h; ++row) {
+            for (int col = 0; col < w; ++col) {
+                uint8_t value = bitmap[row * w + col];
+                size_t index = (static_cast<size_t>(baseRow + row) * size + atlasX + col) * channels;
+                if (font.useSDF) {
+                    page.pixels[index] = value;
+                } else {
+                    page.pixels[index + 0] = 255;
+                    page.pixels[index + 1] = 255;
+                    page.pixels[index + 2] = 255;
+                    page.pixels[index + 3] = value;
+                }
+            }
+        }
+        freeBitmap();
+    }
+
+    pages.push_back(std::move(page));
+    return true;
+}
+
+// ============================================================================
+// 写出资源包
+// ============================================================================
+uint64_t alignUp(uint64_t value) {
+    return (value + bundle::DATA_ALIGNMENT - 1) & ~static_cast<uint64_t>(bundle::DATA_ALIGNMENT - 1);
+}
+
+bool writeBundle(const std::string& path, const std::vector<Page>& pages,
+                 const std::vector<Image>& images, const std::vector<Font>& fonts) {
+    std::string strings;
+    auto addString = [&strings](const std::string& s, uint32_t& offset, uint32_t& length) {
+        offset = static_cast<uint32_t>(strings.size());
+        length = static_cast<uint32_t>(s.size());
+        strings += s;
+    };
+
+    std::vector<bundle::RegionEntry> regions;
+    for (const auto& image : images) {
+        bundle::RegionEntry entry{};
+        addString(image.name, entry.nameOffset, entry.nameLength);
+        entry.page = image.page;
+        entry.x = static_cast<float>(image.x);
+        entry.y = static_cast<float>(image.y);
+        entry.width = static_cast<float>(image.width);
+        entry.height = static_cast<float>(image.height);
+        regions.push_back(entry);
+    }
+
+    std::vector<bundle::FontEntry> fontEntries;
+    std::vector<bundle::GlyphEntry> glyphs;
+    for (const auto& font : fonts) {
+        bundle::FontEntry entry{};
+        addString(font.name, entry.nameOffset, entry.nameLength);
+        entry.page = font.page;
+        entry.fontSize = font.fontSize;
+        entry.flags = font.useSDF ? bundle::FONT_FLAG_SDF : 0;
+        entry.ascent = font.ascent;
+        entry.descent = font.descent;
+        entry.lineGap = font.lineGap;
+        entry.firstGlyph = static_cast<uint32_t>(glyphs.size());
+        entry.glyphCount = static_cast<uint32_t>(font.glyphs.size());
+        glyphs.insert(glyphs.end(), font.glyphs.begin(), font.glyphs.end());
+        fontEntries.push_back(entry);
+    }
+
+    bundle::Header header{};
+    std::memcpy(header.magic, bundle::MAGIC, sizeof(header.magic));
+    header.version = bundle::VERSION;
+    header.pageCount = static_cast<uint32_t>(pages.size());
+    header.regionCount = static_cast<uint32_t>(regions.size());
+    header.fontCount = static_cast<uint32_t>(fontEntries.size());
+    header.glyphCount = static_cast<uint32_t>(glyphs.size());
+    header.stringsOffset = sizeof(header)
+        + pages.size() * sizeof(bundle::PageEntry)
+        + regions.size() * sizeof(bundle::RegionEntry)
+        + fontEntries.size() * sizeof(bundle::FontEntry)
+        + glyphs.size() * sizeof(bundle::GlyphEntry);
+    header.stringsSize = strings.size();
+
+    std::vector<bundle::PageEntry> pageEntries;
+    uint64_t offset = alignUp(header.stringsOffset + header.stringsSize);
+    for (const auto& page : pages) {
+        bundle::PageEntry entry{};
+        entry.width = page.width;
+        entry.height = page.height;
+        entry.format = page.format;
+        entry.dataOffset = offset;
+        entry.dataSize = page.pixels.size();
+        pageEntries.push_back(entry);
+        offset = alignUp(offset + entry.dataSize);
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::fprintf(stderr, "failed to open output: %s\n", path.c_str());
+        return false;
+    }
+
+    auto write = [&out](const void* data, size_t size) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    };
+    auto pad = [&out]() {
+        static const char zeros[bundle::DATA_ALIGNMENT] = {};
+        uint64_t position = static_cast<uint64_t>(out.tellp());
+        out.write(zeros, static_cast<std::streamsize>(alignUp(position) - position));
+    };
+
+    write(&header, sizeof(header));
+    write(pageEntries.data(), pageEntries.size() * sizeof(bundle::PageEntry));
+    write(regions.data(), regions.size() * sizeof(bundle::RegionEntry));
+    write(fontEntries.data(), fontEntries.size() * sizeof(bundle::FontEntry));
+    write(glyphs.data(), glyphs.size() * sizeof(bundle::GlyphEntry));
+    write(strings.data(), strings.size());
+    for (const auto& page : pages) {
+        pad();
+        write(page.pixels.data(), page.pixels.size());
+    }
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseArgs(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<Image> images;
+    if (!loadImages(options, images)) {
+        return 1;
+    }
+
+    std::vector<Page> pages;
+    packImages(options, images, pages);
+
+    std::vector<Font> fonts;
+    std::vector<char32_t> charset = makeCharset(options);
+    for (const auto& spec : options.fonts) {
+        Font font;
+        if (!bakeFont(options, spec, charset, pages, font)) {
+            return 1;
+        }
+        fonts.push_back(std::move(font));
+    }
+
+    if (!writeBundle(options.output, pages, images, fonts)) {
+        return 1;
+    }
+
+    std::printf("cooked %zu images and %zu fonts into %zu pages: %s\n",
+                images.size(), fonts.size(), pages.size(), options.output.c_str());
+    return 0;
+}
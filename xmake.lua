@@ -183,3 +183,13 @@ target("push_box")
         end
     end)
 target_end()
+
+-- ==============================================
+-- 5. 离线资源烘焙工具
+-- ==============================================
+target("easy2d_cook")
+    set_kind("binary")
+    add_files("Easy2D/tools/easy2d_cook/**.cpp")
+    add_deps("easy2d")
+    set_targetdir("$(builddir)/bin")
+target_end()